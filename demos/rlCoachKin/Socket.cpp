@@ -25,6 +25,8 @@
 //
 
 #include <QTextStream>
+#include <rl/hal/Coach.h>
+#include <rl/hal/DeviceException.h>
 #include <rl/math/Rotation.h>
 #include <rl/sg/Body.h>
 #include <rl/sg/Shape.h>
@@ -34,7 +36,8 @@
 #include "Socket.h"
 
 Socket::Socket(QObject* parent) :
-	QTcpSocket(parent)
+	QTcpSocket(parent),
+	protocol(Protocol::unknown)
 {
 	QObject::connect(this, SIGNAL(disconnected()), this, SLOT(deleteLater()));
 	QObject::connect(this, SIGNAL(readyRead()), this, SLOT(readClient()));
@@ -44,8 +47,145 @@ Socket::~Socket()
 {
 }
 
+void
+Socket::readBinary()
+{
+	while (this->bytesAvailable() > 0)
+	{
+		QByteArray data = this->peek(this->bytesAvailable());
+		std::vector<rl::hal::Coach::Command> commands;
+		std::size_t size = 0;
+		
+		try
+		{
+			size = rl::hal::Coach::decode(reinterpret_cast<const std::uint8_t*>(data.constData()), data.size(), commands);
+		}
+		catch (const rl::hal::DeviceException&)
+		{
+			this->abort();
+			return;
+		}
+		
+		if (0 == size)
+		{
+			return;
+		}
+		
+		this->read(size);
+		
+		std::vector<std::uint8_t> reply;
+		std::uint16_t replies = 0;
+		
+		for (std::size_t n = 0; n < commands.size(); ++n)
+		{
+			std::size_t i = commands[n].i;
+			std::size_t j = commands[n].j;
+			std::size_t k = commands[n].k;
+			const rl::math::Vector& values = commands[n].values;
+			
+			switch (commands[n].cmd)
+			{
+			case 0:
+				if (6 == values.size())
+				{
+					rl::math::Transform t;
+					t = rl::math::AngleAxis(values(5), rl::math::Vector3::UnitZ()) *
+						rl::math::AngleAxis(values(4), rl::math::Vector3::UnitY()) *
+						rl::math::AngleAxis(values(3), rl::math::Vector3::UnitX());
+					t.translation().x() = values(0);
+					t.translation().y() = values(1);
+					t.translation().z() = values(2);
+					
+					if (MainWindow::instance()->scene->getNumModels() > i)
+					{
+						if (MainWindow::instance()->scene->getModel(i)->getNumBodies() > j)
+						{
+							MainWindow::instance()->scene->getModel(i)->getBody(j)->setFrame(t);
+						}
+					}
+				}
+				break;
+			case 1:
+				if (6 == values.size())
+				{
+					rl::math::Transform t;
+					t = rl::math::AngleAxis(values(5), rl::math::Vector3::UnitZ()) *
+						rl::math::AngleAxis(values(4), rl::math::Vector3::UnitY()) *
+						rl::math::AngleAxis(values(3), rl::math::Vector3::UnitX());
+					t.translation().x() = values(0);
+					t.translation().y() = values(1);
+					t.translation().z() = values(2);
+					
+					if (MainWindow::instance()->scene->getNumModels() > i)
+					{
+						if (MainWindow::instance()->scene->getModel(i)->getNumBodies() > j)
+						{
+							if (MainWindow::instance()->scene->getModel(i)->getBody(j)->getNumShapes() > k)
+							{
+								MainWindow::instance()->scene->getModel(i)->getBody(j)->getShape(k)->setTransform(t);
+							}
+						}
+					}
+				}
+				break;
+			case 2:
+				if (i < MainWindow::instance()->kinematicModels.size() && static_cast<std::ptrdiff_t>(MainWindow::instance()->kinematicModels[i]->getDof()) == values.size())
+				{
+					MainWindow::instance()->configurationModels[i]->setData(values);
+				}
+				break;
+			case 6:
+				{
+					rl::math::Vector q;
+					
+					if (i < MainWindow::instance()->kinematicModels.size())
+					{
+						q.resize(MainWindow::instance()->kinematicModels[i]->getDof());
+						MainWindow::instance()->kinematicModels[i]->getPosition(q);
+					}
+					
+					rl::hal::Coach::encode(commands[n].cmd, commands[n].i, 0, 0, q, reply);
+					++replies;
+				}
+				break;
+			default:
+				break;
+			}
+		}
+		
+		std::vector<std::uint8_t> frame;
+		rl::hal::Coach::encode(replies, reply, frame);
+		this->write(reinterpret_cast<const char*>(frame.data()), frame.size());
+	}
+}
+
 void
 Socket::readClient()
+{
+	if (Protocol::unknown == this->protocol)
+	{
+		char c = 0;
+		
+		if (this->peek(&c, 1) < 1)
+		{
+			return;
+		}
+		
+		this->protocol = 'R' == c ? Protocol::binary : Protocol::text;
+	}
+	
+	if (Protocol::binary == this->protocol)
+	{
+		this->readBinary();
+	}
+	else
+	{
+		this->readText();
+	}
+}
+
+void
+Socket::readText()
 {
 	QTextStream textStream(this);
 	
@@ -41,7 +41,19 @@ public:
 protected:
 	
 private:
-
+	enum class Protocol
+	{
+		binary,
+		text,
+		unknown
+	};
+	
+	void readBinary();
+	
+	void readText();
+	
+	Protocol protocol;
+	
 private slots:
 	void readClient();
 };
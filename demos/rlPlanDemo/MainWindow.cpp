@@ -50,11 +50,13 @@
 #include <rl/plan/AddRrtConCon.h>
 #include <rl/plan/AdvancedOptimizer.h>
 #include <rl/plan/BridgeSampler.h>
+#include <rl/plan/ContinuousVerifier.h>
 #include <rl/plan/DistanceModel.h>
 #include <rl/plan/Eet.h>
 #include <rl/plan/GaussianSampler.h>
 #include <rl/plan/GnatNearestNeighbors.h>
 #include <rl/plan/KdtreeBoundingBoxNearestNeighbors.h>
+#include <rl/plan/KdtreeFlatNearestNeighbors.h>
 #include <rl/plan/KdtreeNearestNeighbors.h>
 #include <rl/plan/LinearNearestNeighbors.h>
 #include <rl/plan/Prm.h>
@@ -69,6 +71,7 @@
 #include <rl/plan/RrtGoalBias.h>
 #include <rl/plan/SequentialVerifier.h>
 #include <rl/plan/SimpleModel.h>
+#include <rl/plan/ShortcutOptimizer.h>
 #include <rl/plan/SimpleOptimizer.h>
 #include <rl/plan/UniformSampler.h>
 #include <rl/plan/WorkspaceSphereExplorer.h>
@@ -105,6 +108,9 @@
 #ifdef RL_SG_PQP
 #include <rl/sg/pqp/Scene.h>
 #endif // RL_SG_PQP
+#ifdef RL_SG_SDF
+#include <rl/sg/sdf/Scene.h>
+#endif // RL_SG_SDF
 #ifdef RL_SG_SOLID
 #include <rl/sg/solid/Scene.h>
 #endif // RL_SG_SOLID
@@ -851,6 +857,12 @@ MainWindow::load(const QString& filename)
 		this->scene = std::make_shared<rl::sg::pqp::Scene>();
 	}
 #endif // RL_SG_PQP
+#ifdef RL_SG_SDF
+	if ("sdf" == this->engine)
+	{
+		this->scene = std::make_shared<rl::sg::sdf::Scene>();
+	}
+#endif // RL_SG_SDF
 #ifdef RL_SG_SOLID
 	if ("solid" == this->engine)
 	{
@@ -861,6 +873,9 @@ MainWindow::load(const QString& filename)
 	rl::xml::NodeSet modelScene = path.eval("(/rl/plan|/rlplan)//model/scene").getValue<rl::xml::NodeSet>();
 	std::string modelSceneFilename = modelScene[0].getLocalPath(modelScene[0].getProperty("href"));
 	
+	// sphere trees need triangles of bodies
+	std::size_t sphereTreeLeafSize = path.eval("number((/rl/plan|/rlplan)//model/sphereTreeLeafSize)").getValue<std::size_t>(0);
+	
 	if ("urdf" == modelSceneFilename.substr(modelSceneFilename.length() - 4, 4))
 	{
 		rl::sg::UrdfFactory sceneFactory;
@@ -872,7 +887,7 @@ MainWindow::load(const QString& filename)
 	else
 	{
 		rl::sg::XmlFactory sceneFactory;
-		sceneFactory.load(modelSceneFilename, this->scene.get());
+		sceneFactory.load(modelSceneFilename, this->scene.get(), true, sphereTreeLeafSize > 0);
 		this->sceneModel = this->scene->getModel(
 			path.eval("number((/rl/plan|/rlplan)//model/model)").getValue<std::size_t>()
 		);
@@ -1019,6 +1034,11 @@ MainWindow::load(const QString& filename)
 		throw std::runtime_error("selected engine does not support collision queries");
 	}
 	
+	if (rl::plan::SimpleModel* model = dynamic_cast<rl::plan::SimpleModel*>(this->model.get()))
+	{
+		model->setSphereTreeLeafSize(sphereTreeLeafSize);
+	}
+	
 	if (nullptr != this->kin)
 	{
 		this->model->kin = this->kin.get();
@@ -1320,6 +1340,18 @@ MainWindow::load(const QString& filename)
 		
 		this->verifier->setDelta(delta);
 	}
+	else if (path.eval("count((/rl/plan|/rlplan)//continuousVerifier) > 0").getValue<bool>())
+	{
+		this->verifier = std::make_shared<rl::plan::ContinuousVerifier>();
+		rl::math::Real delta = path.eval("number((/rl/plan|/rlplan)//continuousVerifier/delta)").getValue<rl::math::Real>(1);
+		
+		if ("deg" == path.eval("string((/rl/plan|/rlplan)//continuousVerifier/delta/@unit)").getValue<std::string>())
+		{
+			delta *= rl::math::constants::deg2rad;
+		}
+		
+		this->verifier->setDelta(delta);
+	}
 	else if (path.eval("count((/rl/plan|/rlplan)//sequentialVerifier) > 0").getValue<bool>())
 	{
 		this->verifier = std::make_shared<rl::plan::SequentialVerifier>();
@@ -1362,6 +1394,18 @@ MainWindow::load(const QString& filename)
 		
 		this->verifier2->setDelta(delta);
 	}
+	else if (path.eval("count((/rl/plan|/rlplan)//shortcutOptimizer/recursiveVerifier) > 0").getValue<bool>())
+	{
+		this->verifier2 = std::make_shared<rl::plan::RecursiveVerifier>();
+		rl::math::Real delta = path.eval("number((/rl/plan|/rlplan)//shortcutOptimizer/recursiveVerifier/delta)").getValue<rl::math::Real>(1);
+		
+		if ("deg" == path.eval("string((/rl/plan|/rlplan)//shortcutOptimizer/recursiveVerifier/delta/@unit)").getValue<std::string>())
+		{
+			delta *= rl::math::constants::deg2rad;
+		}
+		
+		this->verifier2->setDelta(delta);
+	}
 	
 	if (nullptr != this->verifier2)
 	{
@@ -1388,6 +1432,23 @@ MainWindow::load(const QString& filename)
 		advancedOptimizer->setLength(length);
 		advancedOptimizer->setRatio(path.eval("number((/rl/plan|/rlplan)//advancedOptimizer/ratio)").getValue<rl::math::Real>(static_cast<rl::math::Real>(0.1)));
 	}
+	else if (path.eval("count((/rl/plan|/rlplan)//shortcutOptimizer) > 0").getValue<bool>())
+	{
+		this->optimizer = std::make_shared<rl::plan::ShortcutOptimizer>();
+		rl::plan::ShortcutOptimizer* shortcutOptimizer = static_cast<rl::plan::ShortcutOptimizer*>(this->optimizer.get());
+		shortcutOptimizer->setBatch(static_cast<std::size_t>(path.eval("number((/rl/plan|/rlplan)//shortcutOptimizer/batch)").getValue<rl::math::Real>(16)));
+		
+		if (path.eval("count((/rl/plan|/rlplan)//shortcutOptimizer/seed) > 0").getValue<bool>())
+		{
+			shortcutOptimizer->seed(
+				path.eval("number((/rl/plan|/rlplan)//shortcutOptimizer/seed)").getValue<std::mt19937::result_type>(std::random_device()())
+			);
+		}
+		else if (this->seed)
+		{
+			shortcutOptimizer->seed(*this->seed);
+		}
+	}
 	
 	if (nullptr != this->optimizer)
 	{
@@ -1642,6 +1703,12 @@ MainWindow::load(const QString& filename)
 			}
 			
 			prm->setMaxNeighbors(path.eval("number(k)").getValue<std::size_t>(30));
+			
+			if (path.eval("count(lazy) > 0").getValue<bool>())
+			{
+				prm->setLazy(true);
+			}
+			
 			rl::math::Real radius = path.eval("number(radius)").getValue<rl::math::Real>(std::numeric_limits<rl::math::Real>::max());
 			
 			if ("deg" == path.eval("string(radius/@unit)").getValue<std::string>())
@@ -1665,6 +1732,7 @@ MainWindow::load(const QString& filename)
 			}
 			
 			prmUtilityGuided->setMaxNeighbors(path.eval("number(k)").getValue<std::size_t>(30));
+
 			rl::math::Real radius = path.eval("number(radius)").getValue<rl::math::Real>(std::numeric_limits<rl::math::Real>::max());
 			
 			if ("deg" == path.eval("string(radius/@unit)").getValue<std::string>())
@@ -1890,6 +1958,13 @@ MainWindow::load(const QString& filename)
 				);
 			}
 			
+			if (path.eval("count((/rl/plan|/rlplan)//gnatNearestNeighbors/epsilon) > 0").getValue<bool>())
+			{
+				gnatNearestNeighbors->setEpsilon(
+					path.eval("number((/rl/plan|/rlplan)//gnatNearestNeighbors/epsilon)").getValue<rl::math::Real>(0)
+				);
+			}
+			
 			if (path.eval("count((/rl/plan|/rlplan)//gnatNearestNeighbors/node/data/@max) > 0").getValue<bool>())
 			{
 				gnatNearestNeighbors->setNodeDataMax(
@@ -1942,6 +2017,13 @@ MainWindow::load(const QString& filename)
 				);
 			}
 			
+			if (path.eval("count((/rl/plan|/rlplan)//kdtreeBoundingBoxNearestNeighbors/epsilon) > 0").getValue<bool>())
+			{
+				kdtreeBoundingBoxNearestNeighbors->setEpsilon(
+					path.eval("number((/rl/plan|/rlplan)//kdtreeBoundingBoxNearestNeighbors/epsilon)").getValue<rl::math::Real>(0)
+				);
+			}
+			
 			if (path.eval("count((/rl/plan|/rlplan)//kdtreeBoundingBoxNearestNeighbors/node/data/@max) > 0").getValue<bool>())
 			{
 				kdtreeBoundingBoxNearestNeighbors->setNodeDataMax(
@@ -1951,6 +2033,33 @@ MainWindow::load(const QString& filename)
 			
 			nearestNeighbors = kdtreeBoundingBoxNearestNeighbors;
 		}
+		else if (path.eval("count((/rl/plan|/rlplan)//kdtreeFlatNearestNeighbors) > 0").getValue<bool>())
+		{
+			std::shared_ptr<rl::plan::KdtreeFlatNearestNeighbors> kdtreeFlatNearestNeighbors = std::make_shared<rl::plan::KdtreeFlatNearestNeighbors>(this->model.get());
+			
+			if (path.eval("count((/rl/plan|/rlplan)//kdtreeFlatNearestNeighbors/bucketSize) > 0").getValue<bool>())
+			{
+				kdtreeFlatNearestNeighbors->setBucketSize(
+					path.eval("number((/rl/plan|/rlplan)//kdtreeFlatNearestNeighbors/bucketSize)").getValue<std::size_t>(16)
+				);
+			}
+			
+			if (path.eval("count((/rl/plan|/rlplan)//kdtreeFlatNearestNeighbors/checks) > 0").getValue<bool>())
+			{
+				kdtreeFlatNearestNeighbors->setChecks(
+					path.eval("number((/rl/plan|/rlplan)//kdtreeFlatNearestNeighbors/checks)").getValue<std::size_t>(0)
+				);
+			}
+			
+			if (path.eval("count((/rl/plan|/rlplan)//kdtreeFlatNearestNeighbors/epsilon) > 0").getValue<bool>())
+			{
+				kdtreeFlatNearestNeighbors->setEpsilon(
+					path.eval("number((/rl/plan|/rlplan)//kdtreeFlatNearestNeighbors/epsilon)").getValue<rl::math::Real>(0)
+				);
+			}
+			
+			nearestNeighbors = kdtreeFlatNearestNeighbors;
+		}
 		else if (path.eval("count((/rl/plan|/rlplan)//kdtreeNearestNeighbors) > 0").getValue<bool>())
 		{
 			std::shared_ptr<rl::plan::KdtreeNearestNeighbors> kdtreeNearestNeighbors = std::make_shared<rl::plan::KdtreeNearestNeighbors>(this->model.get());
@@ -1962,6 +2071,13 @@ MainWindow::load(const QString& filename)
 				);
 			}
 			
+			if (path.eval("count((/rl/plan|/rlplan)//kdtreeNearestNeighbors/epsilon) > 0").getValue<bool>())
+			{
+				kdtreeNearestNeighbors->setEpsilon(
+					path.eval("number((/rl/plan|/rlplan)//kdtreeNearestNeighbors/epsilon)").getValue<rl::math::Real>(0)
+				);
+			}
+			
 			if (path.eval("count((/rl/plan|/rlplan)//kdtreeNearestNeighbors/samples) > 0").getValue<bool>())
 			{
 				kdtreeNearestNeighbors->setSamples(
@@ -2116,6 +2232,10 @@ void
 MainWindow::parseCommandLine()
 {
 	QStringList engines;
+#ifdef RL_SG_SDF
+	engines.push_back("sdf");
+	this->engine = "sdf";
+#endif // RL_SG_SDF
 #ifdef RL_SG_FCL
 	engines.push_back("fcl");
 	this->engine = "fcl";
@@ -30,6 +30,7 @@
 #include <boost/iostreams/stream.hpp>
 
 #include "Coach.h"
+#include "DeviceException.h"
 
 namespace rl
 {
@@ -48,9 +49,13 @@ namespace rl
 			JointPositionSensor(dof),
 			JointTorqueActuator(dof),
 			JointVelocityActuator(dof),
+			buffer(),
+			count(0),
+			frame(),
 			i(i),
 			in(),
 			out(),
+			protocol(Protocol::text),
 			socket(Socket::Tcp(Socket::Address::Ipv4(address, port)))
 		{
 		}
@@ -59,6 +64,17 @@ namespace rl
 		{
 		}
 		
+		constexpr ::std::uint32_t Coach::MAGIC;
+		
+		constexpr ::std::uint16_t Coach::VERSION;
+		
+		void
+		Coach::append(const ::std::uint16_t& cmd, const ::rl::math::Vector& values)
+		{
+			encode(cmd, static_cast<::std::uint16_t>(this->i), 0, 0, values, this->buffer);
+			++this->count;
+		}
+		
 		void
 		Coach::close()
 		{
@@ -66,12 +82,127 @@ namespace rl
 			this->setConnected(false);
 		}
 		
+		::std::size_t
+		Coach::decode(const ::std::uint8_t* data, const ::std::size_t& size, ::std::vector<Command>& commands)
+		{
+			commands.clear();
+			
+			if (size < 12)
+			{
+				return 0;
+			}
+			
+			const ::std::uint8_t* ptr = data;
+			::std::uint32_t magic;
+			unserialize(ptr, magic);
+			::std::uint16_t version;
+			unserialize(ptr, version);
+			::std::uint16_t count;
+			unserialize(ptr, count);
+			::std::uint32_t payload;
+			unserialize(ptr, payload);
+			
+			if (MAGIC != magic || VERSION != version)
+			{
+				throw DeviceException("invalid binary frame");
+			}
+			
+			if (size - 12 < payload)
+			{
+				return 0;
+			}
+			
+			const ::std::uint8_t* end = ptr + payload;
+			
+			for (::std::uint16_t n = 0; n < count; ++n)
+			{
+				if (end - ptr < 12)
+				{
+					throw DeviceException("invalid binary frame");
+				}
+				
+				Command command;
+				unserialize(ptr, command.cmd);
+				unserialize(ptr, command.i);
+				unserialize(ptr, command.j);
+				unserialize(ptr, command.k);
+				::std::uint32_t m;
+				unserialize(ptr, m);
+				
+				if (static_cast<::std::size_t>(end - ptr) / sizeof(double) < m)
+				{
+					throw DeviceException("invalid binary frame");
+				}
+				
+				command.values.resize(m);
+				
+				for (::std::ptrdiff_t l = 0; l < command.values.size(); ++l)
+				{
+					double value;
+					unserialize(ptr, value);
+					command.values(l) = value;
+				}
+				
+				commands.push_back(::std::move(command));
+			}
+			
+			return 12 + payload;
+		}
+		
+		void
+		Coach::encode(const ::std::uint16_t& cmd, const ::std::uint16_t& i, const ::std::uint16_t& j, const ::std::uint16_t& k, const ::rl::math::Vector& values, ::std::vector<::std::uint8_t>& payload)
+		{
+			serialize(cmd, payload);
+			serialize(i, payload);
+			serialize(j, payload);
+			serialize(k, payload);
+			serialize(static_cast<::std::uint32_t>(values.size()), payload);
+			
+			for (::std::ptrdiff_t l = 0; l < values.size(); ++l)
+			{
+				serialize(static_cast<double>(values(l)), payload);
+			}
+		}
+		
+		void
+		Coach::encode(const ::std::uint16_t& count, const ::std::vector<::std::uint8_t>& payload, ::std::vector<::std::uint8_t>& frame)
+		{
+			frame.clear();
+			frame.reserve(12 + payload.size());
+			serialize(MAGIC, frame);
+			serialize(VERSION, frame);
+			serialize(count, frame);
+			serialize(static_cast<::std::uint32_t>(payload.size()), frame);
+			frame.insert(frame.end(), payload.begin(), payload.end());
+		}
+		
 		::rl::math::Vector
 		Coach::getJointPosition() const
 		{
 			::rl::math::Vector q(this->getDof());
 			
-			::boost::iostreams::stream<::boost::iostreams::basic_array_source<char>> stream(this->in.data(), this->in.size());
+			if (Protocol::binary == this->protocol)
+			{
+				q.setZero();
+				
+				::std::vector<Command> commands;
+				decode(this->in.data(), this->in.size(), commands);
+				
+				for (::std::size_t n = 0; n < commands.size(); ++n)
+				{
+					if (6 == commands[n].cmd && this->i == commands[n].i)
+					{
+						for (::std::ptrdiff_t l = 0; l < commands[n].values.size() && l < q.size(); ++l)
+						{
+							q(l) = commands[n].values(l);
+						}
+					}
+				}
+				
+				return q;
+			}
+			
+			::boost::iostreams::stream<::boost::iostreams::basic_array_source<char>> stream(reinterpret_cast<const char*>(this->in.data()), this->in.size());
 			
 			::std::size_t cmd;
 			stream >> cmd;
@@ -86,11 +217,23 @@ namespace rl
 			return q;
 		}
 		
+		const Coach::Protocol&
+		Coach::getProtocol() const
+		{
+			return this->protocol;
+		}
+		
 		void
 		Coach::open()
 		{
 			this->socket.open();
 			this->socket.connect();
+			
+			if (Protocol::binary == this->protocol)
+			{
+				this->socket.setOption(Socket::Option::nodelay, 1);
+			}
+			
 			this->setConnected(true);
 		}
 		
@@ -99,9 +242,15 @@ namespace rl
 		{
 			assert(this->getDof() >= q.size());
 			
+			if (Protocol::binary == this->protocol)
+			{
+				this->append(2, q);
+				return;
+			}
+			
 			this->out << 2 << " " << this->i;
 			
-			for (::std::size_t i = 0; i < this->getDof(); ++i)
+			for (::std::ptrdiff_t i = 0; i < q.size(); ++i)
 			{
 				this->out << " " << q(i);
 			}
@@ -114,9 +263,15 @@ namespace rl
 		{
 			assert(this->getDof() >= tau.size());
 			
+			if (Protocol::binary == this->protocol)
+			{
+				this->append(5, tau);
+				return;
+			}
+			
 			this->out << 5 << " " << this->i;
 			
-			for (::std::size_t i = 0; i < this->getDof(); ++i)
+			for (::std::ptrdiff_t i = 0; i < tau.size(); ++i)
 			{
 				this->out << " " << tau(i);
 			}
@@ -129,9 +284,15 @@ namespace rl
 		{
 			assert(this->getDof() >= qd.size());
 			
+			if (Protocol::binary == this->protocol)
+			{
+				this->append(3, qd);
+				return;
+			}
+			
 			this->out << 3 << " " << this->i;
 			
-			for (::std::size_t i = 0; i < this->getDof(); ++i)
+			for (::std::ptrdiff_t i = 0; i < qd.size(); ++i)
 			{
 				this->out << " " << qd(i);
 			}
@@ -139,6 +300,28 @@ namespace rl
 			this->out << ::std::endl;
 		}
 		
+		void
+		Coach::recv(::std::uint8_t* buf, const ::std::size_t& count)
+		{
+			for (::std::size_t numbytes = 0; numbytes < count;)
+			{
+				::std::size_t size = this->socket.recv(buf + numbytes, count - numbytes);
+				
+				if (0 == size)
+				{
+					throw DeviceException("connection closed by server");
+				}
+				
+				numbytes += size;
+			}
+		}
+		
+		void
+		Coach::setProtocol(const Protocol& protocol)
+		{
+			this->protocol = protocol;
+		}
+		
 		void
 		Coach::start()
 		{
@@ -150,15 +333,50 @@ namespace rl
 		{
 			::std::chrono::steady_clock::time_point start = ::std::chrono::steady_clock::now();
 			
-			this->out << 6 << " " << this->i << ::std::endl;
-			
-			this->socket.send(this->out.str().c_str(), this->out.str().length());
-			
-			this->out.clear();
-			this->out.str("");
-			
-			this->in.fill(0);
-			this->socket.recv(this->in.data(), this->in.size());
+			if (Protocol::binary == this->protocol)
+			{
+				this->append(6, ::rl::math::Vector());
+				
+				encode(this->count, this->buffer, this->frame);
+				this->socket.send(this->frame.data(), this->frame.size());
+				
+				this->buffer.clear();
+				this->count = 0;
+				
+				// header followed by payload of reply frame
+				
+				this->in.resize(12);
+				this->recv(this->in.data(), 12);
+				
+				const ::std::uint8_t* ptr = this->in.data();
+				::std::uint32_t magic;
+				unserialize(ptr, magic);
+				::std::uint16_t version;
+				unserialize(ptr, version);
+				ptr += 2;
+				::std::uint32_t size;
+				unserialize(ptr, size);
+				
+				if (MAGIC != magic || VERSION != version)
+				{
+					throw DeviceException("invalid binary frame");
+				}
+				
+				this->in.resize(12 + size);
+				this->recv(this->in.data() + 12, size);
+			}
+			else
+			{
+				this->out << 6 << " " << this->i << ::std::endl;
+				
+				this->socket.send(this->out.str().c_str(), this->out.str().length());
+				
+				this->out.clear();
+				this->out.str("");
+				
+				this->in.resize(1024);
+				this->in.resize(this->socket.recv(this->in.data(), this->in.size()));
+			}
 			
 			::std::this_thread::sleep_until(start + this->getUpdateRate());
 		}
@@ -166,6 +384,8 @@ namespace rl
 		void
 		Coach::stop()
 		{
+			this->buffer.clear();
+			this->count = 0;
 			this->out.clear();
 			this->out.str("");
 			this->setRunning(false);
@@ -27,11 +27,14 @@
 #ifndef RL_HAL_COACH_H
 #define RL_HAL_COACH_H
 
-#include <array>
+#include <cstdint>
+#include <cstring>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "CyclicDevice.h"
+#include "Endian.h"
 #include "JointPositionActuator.h"
 #include "JointPositionSensor.h"
 #include "JointTorqueActuator.h"
@@ -42,9 +45,52 @@ namespace rl
 {
 	namespace hal
 	{
+		/**
+		 * Client for the rlCoachKin, rlCoachMdl, and rlSimulator visualization servers.
+		 *
+		 * Commands are sent either as whitespace-separated text lines or, if
+		 * selected via setProtocol(), as compact little-endian binary frames.
+		 * A binary frame consists of a 12 byte header (magic "RLCB",
+		 * version, number of commands, payload size) followed by all commands
+		 * of one step, each with a 12 byte header (command, robot index,
+		 * body index, shape index, number of values) and packed doubles. The
+		 * servers detect the protocol from the first byte of a connection,
+		 * so text clients keep working unchanged.
+		 */
 		class RL_HAL_EXPORT Coach : public CyclicDevice, public JointPositionActuator, public JointPositionSensor, public JointTorqueActuator, public JointVelocityActuator
 		{
 		public:
+			/**
+			 * Command of a binary frame.
+			 */
+			struct Command
+			{
+				::std::uint16_t cmd;
+				
+				/** Robot index. */
+				::std::uint16_t i;
+				
+				/** Body index. */
+				::std::uint16_t j;
+				
+				/** Shape index. */
+				::std::uint16_t k;
+				
+				::rl::math::Vector values;
+			};
+			
+			enum class Protocol
+			{
+				binary,
+				text
+			};
+			
+			/** Magic number "RLCB" at the start of a binary frame. */
+			static constexpr ::std::uint32_t MAGIC = 0x42434C52;
+			
+			/** Version of the binary protocol. */
+			static constexpr ::std::uint16_t VERSION = 1;
+			
 			Coach(
 				const ::std::size_t& dof,
 				const ::std::chrono::nanoseconds& updateRate,
@@ -57,8 +103,29 @@ namespace rl
 			
 			void close();
 			
+			/**
+			 * Decode binary frame at the start of a buffer.
+			 *
+			 * @return number of bytes of the frame, or zero if the buffer does not
+			 * yet contain a complete frame
+			 * @throws DeviceException if the frame header or payload is invalid
+			 */
+			static ::std::size_t decode(const ::std::uint8_t* data, const ::std::size_t& size, ::std::vector<Command>& commands);
+			
+			/**
+			 * Append command to payload of binary frame.
+			 */
+			static void encode(const ::std::uint16_t& cmd, const ::std::uint16_t& i, const ::std::uint16_t& j, const ::std::uint16_t& k, const ::rl::math::Vector& values, ::std::vector<::std::uint8_t>& payload);
+			
+			/**
+			 * Encode binary frame with given number of commands and payload.
+			 */
+			static void encode(const ::std::uint16_t& count, const ::std::vector<::std::uint8_t>& payload, ::std::vector<::std::uint8_t>& frame);
+			
 			::rl::math::Vector getJointPosition() const;
 			
+			const Protocol& getProtocol() const;
+			
 			void open();
 			
 			void setJointPosition(const ::rl::math::Vector& q);
@@ -67,6 +134,11 @@ namespace rl
 			
 			void setJointVelocity(const ::rl::math::Vector& qd);
 			
+			/**
+			 * Select wire format, must be called before open().
+			 */
+			void setProtocol(const Protocol& protocol);
+			
 			void start();
 			
 			void step();
@@ -76,12 +148,41 @@ namespace rl
 		protected:
 			
 		private:
+			void append(const ::std::uint16_t& cmd, const ::rl::math::Vector& values);
+			
+			void recv(::std::uint8_t* buf, const ::std::size_t& count);
+			
+			template<typename T>
+			static void serialize(T t, ::std::vector<::std::uint8_t>& buffer)
+			{
+				Endian::hostToLittle(t);
+				::std::size_t size = buffer.size();
+				buffer.resize(size + sizeof(t));
+				::std::memcpy(buffer.data() + size, &t, sizeof(t));
+			}
+			
+			template<typename T>
+			static void unserialize(const ::std::uint8_t*& ptr, T& t)
+			{
+				::std::memcpy(&t, ptr, sizeof(t));
+				Endian::littleToHost(t);
+				ptr += sizeof(t);
+			}
+			
+			::std::vector<::std::uint8_t> buffer;
+			
+			::std::uint16_t count;
+			
+			::std::vector<::std::uint8_t> frame;
+			
 			::std::size_t i;
 			
-			::std::array<char, 1024> in;
+			::std::vector<::std::uint8_t> in;
 			
 			::std::stringstream out;
 			
+			Protocol protocol;
+			
 			Socket socket;
 		};
 	}
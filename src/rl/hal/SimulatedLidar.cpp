@@ -0,0 +1,209 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <thread>
+
+#include "SimulatedLidar.h"
+
+namespace rl
+{
+	namespace hal
+	{
+		SimulatedLidar::SimulatedLidar(
+			::rl::sg::RaycastScene* scene,
+			const ::std::chrono::nanoseconds& updateRate,
+			const ::std::size_t& count,
+			const ::rl::math::Real& startAngle,
+			const ::rl::math::Real& stopAngle,
+			const ::rl::math::Real& distancesMinimum,
+			const ::rl::math::Real& distancesMaximum
+		) :
+			CyclicDevice(updateRate),
+			Lidar(),
+			directions(count),
+			distances(count),
+			distancesMaximum(distancesMaximum),
+			distancesMinimum(distancesMinimum),
+			frame(::rl::math::Transform::Identity()),
+			scene(scene),
+			shapes(count, nullptr),
+			sources(count),
+			startAngle(startAngle),
+			stopAngle(stopAngle),
+			targets(count)
+		{
+			assert(count > 1);
+			
+			for (::std::size_t i = 0; i < count; ++i)
+			{
+				::rl::math::Real angle = startAngle + (stopAngle - startAngle) * i / (count - 1);
+				this->directions[i] = ::rl::math::Vector3(::std::cos(angle), ::std::sin(angle), 0);
+			}
+			
+			this->distances.setConstant(::std::numeric_limits<::rl::math::Real>::quiet_NaN());
+		}
+		
+		SimulatedLidar::~SimulatedLidar()
+		{
+		}
+		
+		void
+		SimulatedLidar::close()
+		{
+			assert(this->isConnected());
+			
+			this->setConnected(false);
+		}
+		
+		::rl::math::Vector
+		SimulatedLidar::getDistances() const
+		{
+			assert(this->isConnected());
+			
+			return this->distances;
+		}
+		
+		::std::size_t
+		SimulatedLidar::getDistancesCount() const
+		{
+			return this->directions.size();
+		}
+		
+		::rl::math::Real
+		SimulatedLidar::getDistancesMaximum(const ::std::size_t& i) const
+		{
+			assert(i < this->getDistancesCount());
+			
+			return this->distancesMaximum;
+		}
+		
+		::rl::math::Real
+		SimulatedLidar::getDistancesMinimum(const ::std::size_t& i) const
+		{
+			assert(i < this->getDistancesCount());
+			
+			return this->distancesMinimum;
+		}
+		
+		const ::rl::math::Transform&
+		SimulatedLidar::getFrame() const
+		{
+			return this->frame;
+		}
+		
+		::rl::math::Real
+		SimulatedLidar::getResolution() const
+		{
+			return ::std::abs(this->getStopAngle() - this->getStartAngle()) / (this->getDistancesCount() - 1);
+		}
+		
+		::rl::sg::RaycastScene*
+		SimulatedLidar::getScene() const
+		{
+			return this->scene;
+		}
+		
+		const ::std::vector<::rl::sg::Shape*>&
+		SimulatedLidar::getShapes() const
+		{
+			return this->shapes;
+		}
+		
+		::rl::math::Real
+		SimulatedLidar::getStartAngle() const
+		{
+			return this->startAngle;
+		}
+		
+		::rl::math::Real
+		SimulatedLidar::getStopAngle() const
+		{
+			return this->stopAngle;
+		}
+		
+		void
+		SimulatedLidar::open()
+		{
+			this->setConnected(true);
+		}
+		
+		void
+		SimulatedLidar::setFrame(const ::rl::math::Transform& frame)
+		{
+			this->frame = frame;
+		}
+		
+		void
+		SimulatedLidar::start()
+		{
+			assert(this->isConnected());
+			
+			this->setRunning(true);
+		}
+		
+		void
+		SimulatedLidar::step()
+		{
+			assert(this->isRunning());
+			
+			::std::chrono::steady_clock::time_point start = ::std::chrono::steady_clock::now();
+			
+			for (::std::size_t i = 0; i < this->directions.size(); ++i)
+			{
+				this->sources[i] = this->frame.translation();
+				this->targets[i] = this->frame * (this->distancesMaximum * this->directions[i]);
+			}
+			
+			this->scene->raycast(this->sources, this->targets, this->shapes, this->distances);
+			
+			for (::std::ptrdiff_t i = 0; i < this->distances.size(); ++i)
+			{
+				if (nullptr == this->shapes[i])
+				{
+					this->distances(i) = ::std::numeric_limits<::rl::math::Real>::infinity();
+				}
+				else if (this->distances(i) < this->distancesMinimum)
+				{
+					this->distances(i) = ::std::numeric_limits<::rl::math::Real>::quiet_NaN();
+					this->shapes[i] = nullptr;
+				}
+			}
+			
+			::std::this_thread::sleep_until(start + this->getUpdateRate());
+		}
+		
+		void
+		SimulatedLidar::stop()
+		{
+			assert(this->isRunning());
+			
+			this->setRunning(false);
+		}
+	}
+}
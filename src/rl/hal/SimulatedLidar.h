@@ -0,0 +1,131 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef RL_HAL_SIMULATEDLIDAR_H
+#define RL_HAL_SIMULATEDLIDAR_H
+
+#include <vector>
+#include <rl/math/Constants.h>
+#include <rl/math/Transform.h>
+#include <rl/sg/RaycastScene.h>
+
+#include "CyclicDevice.h"
+#include "Lidar.h"
+
+namespace rl
+{
+	namespace hal
+	{
+		/**
+		 * Planar laser scanner simulated via raycasting in a scene.
+		 *
+		 * All beams of a scan are cast as one batch. Beams lie in the x-y
+		 * plane of the sensor frame, with angles measured around its z-axis
+		 * starting at the x-axis. As with SickLms200, beams without an echo
+		 * within the maximum range are reported as infinity and echoes closer
+		 * than the minimum range as NaN.
+		 */
+		class RL_HAL_EXPORT SimulatedLidar : public CyclicDevice, public Lidar
+		{
+		public:
+			EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+			
+			SimulatedLidar(
+				::rl::sg::RaycastScene* scene,
+				const ::std::chrono::nanoseconds& updateRate = ::std::chrono::milliseconds(40),
+				const ::std::size_t& count = 541,
+				const ::rl::math::Real& startAngle = -135 * ::rl::math::constants::deg2rad,
+				const ::rl::math::Real& stopAngle = 135 * ::rl::math::constants::deg2rad,
+				const ::rl::math::Real& distancesMinimum = 0,
+				const ::rl::math::Real& distancesMaximum = 30
+			);
+			
+			virtual ~SimulatedLidar();
+			
+			void close();
+			
+			::rl::math::Vector getDistances() const;
+			
+			::std::size_t getDistancesCount() const;
+			
+			::rl::math::Real getDistancesMaximum(const ::std::size_t& i) const;
+			
+			::rl::math::Real getDistancesMinimum(const ::std::size_t& i) const;
+			
+			const ::rl::math::Transform& getFrame() const;
+			
+			::rl::math::Real getResolution() const;
+			
+			::rl::sg::RaycastScene* getScene() const;
+			
+			const ::std::vector<::rl::sg::Shape*>& getShapes() const;
+			
+			::rl::math::Real getStartAngle() const;
+			
+			::rl::math::Real getStopAngle() const;
+			
+			void open();
+			
+			/**
+			 * @param[in] frame Sensor frame in world coordinates
+			 */
+			void setFrame(const ::rl::math::Transform& frame);
+			
+			void start();
+			
+			void step();
+			
+			void stop();
+			
+		protected:
+			
+		private:
+			::std::vector<::rl::math::Vector3> directions;
+			
+			::rl::math::Vector distances;
+			
+			::rl::math::Real distancesMaximum;
+			
+			::rl::math::Real distancesMinimum;
+			
+			::rl::math::Transform frame;
+			
+			::rl::sg::RaycastScene* scene;
+			
+			::std::vector<::rl::sg::Shape*> shapes;
+			
+			::std::vector<::rl::math::Vector3> sources;
+			
+			::rl::math::Real startAngle;
+			
+			::rl::math::Real stopAngle;
+			
+			::std::vector<::rl::math::Vector3> targets;
+		};
+	}
+}
+
+#endif // RL_HAL_SIMULATEDLIDAR_H
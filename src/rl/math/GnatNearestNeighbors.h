@@ -36,6 +36,8 @@
 #include <vector>
 #include <boost/optional.hpp>
 
+#include "metrics/distances.h"
+
 namespace rl
 {
 	namespace math
@@ -76,6 +78,7 @@ namespace rl
 			
 			explicit GnatNearestNeighbors(const Metric& metric) :
 				checks(),
+				epsilon(0),
 				generator(::std::random_device()()),
 				metric(metric),
 				nodeDataMax(50),
@@ -89,6 +92,7 @@ namespace rl
 			
 			explicit GnatNearestNeighbors(Metric&& metric = Metric()) :
 				checks(),
+				epsilon(0),
 				generator(::std::random_device()()),
 				metric(::std::move(metric)),
 				nodeDataMax(50),
@@ -103,6 +107,7 @@ namespace rl
 			template<typename InputIterator>
 			GnatNearestNeighbors(InputIterator first, InputIterator last, const Metric& metric) :
 				checks(),
+				epsilon(0),
 				generator(::std::random_device()()),
 				metric(metric),
 				nodeDataMax(50),
@@ -121,6 +126,7 @@ namespace rl
 			template<typename InputIterator>
 			GnatNearestNeighbors(InputIterator first, InputIterator last, Metric&& metric = Metric()) :
 				checks(),
+				epsilon(0),
 				generator(::std::random_device()()),
 				metric(::std::move(metric)),
 				nodeDataMax(50),
@@ -167,6 +173,11 @@ namespace rl
 				return this->checks;
 			}
 			
+			Distance getEpsilon() const
+			{
+				return this->epsilon;
+			}
+			
 			::std::size_t getNodeDataMax() const
 			{
 				return this->nodeDataMax;
@@ -236,6 +247,11 @@ namespace rl
 				this->checks = checks;
 			}
 			
+			void setEpsilon(const Distance& epsilon)
+			{
+				this->epsilon = epsilon;
+			}
+			
 			void setNodeDataMax(const ::std::size_t& nodeDataMax)
 			{
 				this->nodeDataMax = nodeDataMax;
@@ -265,6 +281,7 @@ namespace rl
 			{
 				using ::std::swap;
 				swap(this->generator, other.generator);
+				swap(this->epsilon, other.epsilon);
 				swap(this->metric, other.metric);
 				swap(this->nodeDegree, other.nodeDegree);
 				swap(this->nodeDegreeMax, other.nodeDegreeMax);
@@ -467,7 +484,8 @@ namespace rl
 				::std::size_t checks = 0;
 				
 				::std::vector<Branch> branches;
-				this->search(this->root, query, k, radius, branches, neighbors, checks);
+				::std::vector<Distance> distances;
+				this->search(this->root, query, k, radius, branches, neighbors, distances, checks);
 				
 				while (!branches.empty() && (!this->checks || checks < this->checks))
 				{
@@ -477,7 +495,7 @@ namespace rl
 					
 					if (nullptr == k || *k == neighbors.size())
 					{
-						Distance distance = nullptr != radius ? *radius : neighbors.front().first;
+						Distance distance = nullptr != radius ? *radius : neighbors.front().first / (1 + this->epsilon);
 						
 						if (branch.first - distance > branch.second->max[branch.second->index] ||
 							branch.first + distance < branch.second->min[branch.second->index])
@@ -486,7 +504,7 @@ namespace rl
 						}
 					}
 					
-					this->search(*branch.second, query, k, radius, branches, neighbors, checks);
+					this->search(*branch.second, query, k, radius, branches, neighbors, distances, checks);
 				}
 				
 				if (sorted)
@@ -497,17 +515,18 @@ namespace rl
 				return neighbors;
 			}
 			
-			void search(const Node& node, const Value& query, const ::std::size_t* k, const Distance* radius, ::std::vector<Branch>& branches, ::std::vector<Neighbor>& neighbors, ::std::size_t& checks) const
+			void search(const Node& node, const Value& query, const ::std::size_t* k, const Distance* radius, ::std::vector<Branch>& branches, ::std::vector<Neighbor>& neighbors, ::std::vector<Distance>& distances, ::std::size_t& checks) const
 			{
 				if (node.children.empty())
 				{
+					distances.resize(node.data.size());
+					::rl::math::metrics::distances(this->metric, query, node.data.begin(), node.data.end(), distances.data());
+					
 					for (::std::size_t i = 0; i < node.data.size(); ++i)
 					{
-						Distance distance = this->metric(query, node.data[i]);
-						
-						if (nullptr == k || neighbors.size() < *k || distance < neighbors.front().first)
+						if (nullptr == k || neighbors.size() < *k || distances[i] < neighbors.front().first)
 						{
-							if (nullptr == radius || distance < *radius)
+							if (nullptr == radius || distances[i] < *radius)
 							{
 								if (nullptr != k && *k == neighbors.size())
 								{
@@ -515,7 +534,7 @@ namespace rl
 									neighbors.pop_back();
 								}
 								
-								neighbors.emplace_back(distance, node.data[i]);
+								neighbors.emplace_back(distances[i], node.data[i]);
 								::std::push_heap(neighbors.begin(), neighbors.end(), NeighborCompare());
 							}
 						}
@@ -528,7 +547,7 @@ namespace rl
 				}
 				else
 				{
-					::std::vector<Distance> distances(node.children.size());
+					distances.resize(node.children.size());
 					::std::vector<bool> removed(node.children.size(), false);
 					
 					for (::std::size_t i = 0; i < node.children.size(); ++i)
@@ -557,7 +576,7 @@ namespace rl
 							
 							if (nullptr == k || *k == neighbors.size())
 							{
-								Distance distance = nullptr != radius ? *radius : neighbors.front().first;
+								Distance distance = nullptr != radius ? *radius : neighbors.front().first / (1 + this->epsilon);
 								
 								for (::std::size_t j = 0; j < node.children.size(); ++j)
 								{
@@ -583,7 +602,7 @@ namespace rl
 					{
 						if (!removed[i])
 						{
-							Distance distance = nullptr != radius ? *radius : neighbors.front().first;
+							Distance distance = nullptr != radius ? *radius : neighbors.front().first / (1 + this->epsilon);
 							
 							if (distances[i] - distance <= node.children[i].max[i] &&
 								distances[i] + distance >= node.children[i].min[i])
@@ -678,6 +697,8 @@ namespace rl
 			
 			::boost::optional<::std::size_t> checks;
 			
+			Distance epsilon;
+			
 			::std::mt19937 generator;
 			
 			Metric metric;
@@ -84,6 +84,7 @@ namespace rl
 			explicit KdtreeBoundingBoxNearestNeighbors(const Metric& metric) :
 				boundingBox(),
 				checks(),
+				epsilon(0),
 				metric(metric),
 				nodeDataMax(10),
 				root(),
@@ -94,6 +95,7 @@ namespace rl
 			explicit KdtreeBoundingBoxNearestNeighbors(Metric&& metric = Metric()) :
 				boundingBox(),
 				checks(),
+				epsilon(0),
 				metric(::std::move(metric)),
 				nodeDataMax(10),
 				root(),
@@ -105,6 +107,7 @@ namespace rl
 			KdtreeBoundingBoxNearestNeighbors(InputIterator first, InputIterator last, const Metric& metric) :
 				boundingBox(),
 				checks(),
+				epsilon(0),
 				metric(metric),
 				nodeDataMax(10),
 				root(),
@@ -117,6 +120,7 @@ namespace rl
 			KdtreeBoundingBoxNearestNeighbors(InputIterator first, InputIterator last, Metric&& metric = Metric()) :
 				boundingBox(),
 				checks(),
+				epsilon(0),
 				metric(::std::move(metric)),
 				nodeDataMax(10),
 				root(),
@@ -156,6 +160,11 @@ namespace rl
 				return this->checks;
 			}
 			
+			Distance getEpsilon() const
+			{
+				return this->epsilon;
+			}
+			
 			::std::size_t getNodeDataMax() const
 			{
 				return this->nodeDataMax;
@@ -238,6 +247,11 @@ namespace rl
 				this->checks = checks;
 			}
 			
+			void setEpsilon(const Distance& epsilon)
+			{
+				this->epsilon = epsilon;
+			}
+			
 			void setNodeDataMax(const ::std::size_t& nodeDataMax)
 			{
 				this->nodeDataMax = nodeDataMax;
@@ -252,6 +266,7 @@ namespace rl
 			{
 				using ::std::swap;
 				swap(this->mean, other.mean);
+				swap(this->epsilon, other.epsilon);
 				swap(this->metric, other.metric);
 				swap(this->samples, other.samples);
 				swap(this->root, other.root);
@@ -610,7 +625,7 @@ namespace rl
 					Distance cutdist = this->metric(value, diff < 0 ? node.interval.high : node.interval.low, node.index);
 					Distance newdist = mindist - sidedist[node.index] + cutdist;
 					
-					if (nullptr == k || neighbors.size() < *k || newdist <= neighbors.front().first)
+					if (nullptr == k || neighbors.size() < *k || newdist * (1 + this->epsilon) <= neighbors.front().first)
 					{
 						if (!this->checks)
 						{
@@ -692,6 +707,8 @@ namespace rl
 			
 			::boost::optional<::std::size_t> checks;
 			
+			Distance epsilon;
+			
 			Metric metric;
 			
 			::std::size_t nodeDataMax;
@@ -0,0 +1,603 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef RL_MATH_KDTREEFLATNEARESTNEIGHBORS_H
+#define RL_MATH_KDTREEFLATNEARESTNEIGHBORS_H
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/optional.hpp>
+#include <rl/std/iterator.h>
+
+#include "metrics/distances.h"
+
+namespace rl
+{
+	namespace math
+	{
+		/**
+		 * k-d tree with flat storage.
+		 *
+		 * Nodes of each tree are stored in preorder in one contiguous buffer,
+		 * with the left child following its parent. Leaves reference buckets of
+		 * values stored contiguously in the same order. Cuts are placed at the
+		 * median of the dimension with largest spread.
+		 *
+		 * Pushing values uses the logarithmic method: values are collected in
+		 * an unstructured bucket, full buckets are merged with trees of equal
+		 * size and rebuilt, so tree i holds bucket * 2^i values. Queries search
+		 * all trees with a shared set of neighbors.
+		 *
+		 * Jon Louis Bentley and James B. Saxe. Decomposable searching problems
+		 * I. Static-to-dynamic transformation. Journal of Algorithms,
+		 * 1(4):301-358, December 1980.
+		 *
+		 * http://dx.doi.org/10.1016/0196-6774(80)90015-2
+		 */
+		template<typename MetricT>
+		class KdtreeFlatNearestNeighbors
+		{
+		private:
+			struct Tree;
+			
+		public:
+			typedef const typename MetricT::Value& const_reference;
+			
+			typedef ::std::ptrdiff_t difference_type;
+			
+			typedef typename MetricT::Value& reference;
+			
+			typedef ::std::size_t size_type;
+			
+			typedef typename MetricT::Value value_type;
+			
+			typedef typename MetricT::Distance Distance;
+			
+			typedef MetricT Metric;
+			
+			typedef typename MetricT::Size Size;
+			
+			typedef typename MetricT::Value Value;
+			
+			typedef ::std::pair<Distance, Value> Neighbor;
+			
+			explicit KdtreeFlatNearestNeighbors(const Metric& metric) :
+				bucket(),
+				bucketSize(16),
+				checks(),
+				epsilon(0),
+				metric(metric),
+				trees(),
+				values(0)
+			{
+			}
+			
+			explicit KdtreeFlatNearestNeighbors(Metric&& metric = Metric()) :
+				bucket(),
+				bucketSize(16),
+				checks(),
+				epsilon(0),
+				metric(::std::move(metric)),
+				trees(),
+				values(0)
+			{
+			}
+			
+			template<typename InputIterator>
+			KdtreeFlatNearestNeighbors(InputIterator first, InputIterator last, const Metric& metric) :
+				bucket(),
+				bucketSize(16),
+				checks(),
+				epsilon(0),
+				metric(metric),
+				trees(),
+				values(0)
+			{
+				this->insert(first, last);
+			}
+			
+			template<typename InputIterator>
+			KdtreeFlatNearestNeighbors(InputIterator first, InputIterator last, Metric&& metric = Metric()) :
+				bucket(),
+				bucketSize(16),
+				checks(),
+				epsilon(0),
+				metric(::std::move(metric)),
+				trees(),
+				values(0)
+			{
+				this->insert(first, last);
+			}
+			
+			~KdtreeFlatNearestNeighbors()
+			{
+			}
+			
+			void clear()
+			{
+				this->bucket.clear();
+				this->trees.clear();
+				this->values = 0;
+			}
+			
+			::std::vector<Value> data() const
+			{
+				::std::vector<Value> data;
+				data.reserve(this->values);
+				data.insert(data.end(), this->bucket.begin(), this->bucket.end());
+				
+				for (::std::size_t i = 0; i < this->trees.size(); ++i)
+				{
+					data.insert(data.end(), this->trees[i].values.begin(), this->trees[i].values.end());
+				}
+				
+				return data;
+			}
+			
+			bool empty() const
+			{
+				return 0 == this->values;
+			}
+			
+			::std::size_t getBucketSize() const
+			{
+				return this->bucketSize;
+			}
+			
+			::boost::optional<::std::size_t> getChecks() const
+			{
+				return this->checks;
+			}
+			
+			Distance getEpsilon() const
+			{
+				return this->epsilon;
+			}
+			
+			template<typename InputIterator>
+			void insert(InputIterator first, InputIterator last)
+			{
+				if (this->empty())
+				{
+					Tree tree;
+					tree.values.assign(first, last);
+					this->values = tree.values.size();
+					
+					// sizes of the logarithmic method are not required for the initial tree
+					
+					if (this->values > this->bucketSize)
+					{
+						this->build(tree);
+						this->trees.push_back(::std::move(tree));
+					}
+					else
+					{
+						this->bucket.swap(tree.values);
+					}
+				}
+				else
+				{
+					for (InputIterator i = first; i != last; ++i)
+					{
+						this->push(*i);
+					}
+				}
+			}
+			
+			::std::vector<Neighbor> nearest(const Value& query, const ::std::size_t& k, const bool& sorted = true) const
+			{
+				return this->search(query, &k, nullptr, sorted);
+			}
+			
+			void push(const Value& value)
+			{
+				this->bucket.push_back(value);
+				++this->values;
+				
+				if (this->bucket.size() < this->bucketSize)
+				{
+					return;
+				}
+				
+				// merge full bucket with trees of equal size
+				
+				Tree tree;
+				tree.values.swap(this->bucket);
+				
+				::std::size_t i = 0;
+				
+				for (; i < this->trees.size() && !this->trees[i].values.empty(); ++i)
+				{
+					tree.values.insert(tree.values.end(), this->trees[i].values.begin(), this->trees[i].values.end());
+					this->trees[i].nodes.clear();
+					this->trees[i].values.clear();
+				}
+				
+				this->build(tree);
+				
+				if (i < this->trees.size())
+				{
+					this->trees[i] = ::std::move(tree);
+				}
+				else
+				{
+					this->trees.push_back(::std::move(tree));
+				}
+			}
+			
+			::std::vector<Neighbor> radius(const Value& query, const Distance& radius, const bool& sorted = true) const
+			{
+				return this->search(query, nullptr, &radius, sorted);
+			}
+			
+			void setBucketSize(const ::std::size_t& bucketSize)
+			{
+				this->bucketSize = ::std::max(bucketSize, static_cast<::std::size_t>(1));
+			}
+			
+			void setChecks(const ::boost::optional<::std::size_t>& checks)
+			{
+				this->checks = checks;
+			}
+			
+			void setEpsilon(const Distance& epsilon)
+			{
+				this->epsilon = epsilon;
+			}
+			
+			::std::size_t size() const
+			{
+				return this->values;
+			}
+			
+			void swap(KdtreeFlatNearestNeighbors& other)
+			{
+				using ::std::swap;
+				swap(this->bucket, other.bucket);
+				swap(this->bucketSize, other.bucketSize);
+				swap(this->checks, other.checks);
+				swap(this->epsilon, other.epsilon);
+				swap(this->metric, other.metric);
+				swap(this->trees, other.trees);
+				swap(this->values, other.values);
+			}
+			
+			friend void swap(KdtreeFlatNearestNeighbors& lhs, KdtreeFlatNearestNeighbors& rhs)
+			{
+				lhs.swap(rhs);
+			}
+			
+		protected:
+			
+		private:
+			struct Branch
+			{
+				Distance dist;
+				
+				::std::size_t node;
+				
+				/** Offset of side distances in shared buffer. */
+				::std::size_t sidedist;
+				
+				const Tree* tree;
+			};
+			
+			struct BranchCompare
+			{
+				bool operator()(const Branch& lhs, const Branch& rhs) const
+				{
+					return lhs.dist > rhs.dist;
+				}
+			};
+			
+			struct Compare
+			{
+				bool operator()(const Value& lhs, const Value& rhs) const
+				{
+					using ::std::begin;
+					return *(begin(lhs) + this->index) < *(begin(rhs) + this->index);
+				}
+				
+				Size index;
+			};
+			
+			struct NeighborCompare
+			{
+				bool operator()(const Neighbor& lhs, const Neighbor& rhs) const
+				{
+					return lhs.first < rhs.first;
+				}
+			};
+			
+			struct Node
+			{
+				/** First value of subtree. */
+				::std::size_t begin;
+				
+				/** One past last value of subtree. */
+				::std::size_t end;
+				
+				Size index;
+				
+				/** Index of right child, zero for leaves. */
+				::std::size_t right;
+				
+				Distance value;
+			};
+			
+			struct Tree
+			{
+				::std::vector<Node> nodes;
+				
+				::std::vector<Value> values;
+			};
+			
+			struct Search
+			{
+				::std::vector<Branch> branches;
+				
+				::std::size_t checks;
+				
+				::std::vector<Distance> distances;
+				
+				const ::std::size_t* k;
+				
+				::std::vector<Neighbor> neighbors;
+				
+				const Value* query;
+				
+				const Distance* radius;
+				
+				::std::vector<Distance> sidedists;
+			};
+			
+			void build(Tree& tree) const
+			{
+				tree.nodes.clear();
+				tree.nodes.reserve(2 * (tree.values.size() / this->bucketSize) + 1);
+				this->build(tree, 0, tree.values.size());
+			}
+			
+			::std::size_t build(Tree& tree, const ::std::size_t& first, const ::std::size_t& last) const
+			{
+				using ::std::begin;
+				using ::rl::std17::size;
+				
+				::std::size_t n = tree.nodes.size();
+				tree.nodes.push_back(Node());
+				tree.nodes[n].begin = first;
+				tree.nodes[n].end = last;
+				tree.nodes[n].index = 0;
+				tree.nodes[n].right = 0;
+				tree.nodes[n].value = Distance();
+				
+				if (last - first <= this->bucketSize)
+				{
+					return n;
+				}
+				
+				// dimension with largest spread
+				
+				Compare compare;
+				compare.index = 0;
+				Distance spread = Distance();
+				::std::size_t dim = size(tree.values[first]);
+				
+				for (::std::size_t i = 0; i < dim; ++i)
+				{
+					Distance min = *(begin(tree.values[first]) + i);
+					Distance max = min;
+					
+					for (::std::size_t j = first + 1; j < last; ++j)
+					{
+						min = ::std::min(min, *(begin(tree.values[j]) + i));
+						max = ::std::max(max, *(begin(tree.values[j]) + i));
+					}
+					
+					if (max - min > spread)
+					{
+						spread = max - min;
+						compare.index = i;
+					}
+				}
+				
+				::std::size_t middle = first + (last - first) / 2;
+				::std::nth_element(tree.values.begin() + first, tree.values.begin() + middle, tree.values.begin() + last, compare);
+				
+				tree.nodes[n].index = compare.index;
+				tree.nodes[n].value = *(begin(tree.values[middle]) + compare.index);
+				
+				this->build(tree, first, middle);
+				::std::size_t right = this->build(tree, middle, last);
+				tree.nodes[n].right = right;
+				
+				return n;
+			}
+			
+			template<typename InputIterator>
+			void check(InputIterator first, InputIterator last, Search& search) const
+			{
+				search.distances.resize(::std::distance(first, last));
+				::rl::math::metrics::distances(this->metric, *search.query, first, last, search.distances.data());
+				
+				for (::std::size_t i = 0; first != last; ++first, ++i)
+				{
+					if (nullptr == search.k || search.neighbors.size() < *search.k || search.distances[i] < search.neighbors.front().first)
+					{
+						if (nullptr == search.radius || search.distances[i] < *search.radius)
+						{
+							if (nullptr != search.k && *search.k == search.neighbors.size())
+							{
+								::std::pop_heap(search.neighbors.begin(), search.neighbors.end(), NeighborCompare());
+								search.neighbors.pop_back();
+							}
+							
+							search.neighbors.emplace_back(search.distances[i], *first);
+							::std::push_heap(search.neighbors.begin(), search.neighbors.end(), NeighborCompare());
+						}
+					}
+					
+					++search.checks;
+				}
+			}
+			
+			::std::vector<Neighbor> search(const Value& query, const ::std::size_t* k, const Distance* radius, const bool& sorted) const
+			{
+				using ::rl::std17::size;
+				
+				Search search;
+				search.checks = 0;
+				search.k = k;
+				search.query = &query;
+				search.radius = radius;
+				
+				if (this->empty())
+				{
+					return search.neighbors;
+				}
+				
+				if (nullptr != k)
+				{
+					search.neighbors.reserve(::std::min(*k, this->size()));
+				}
+				
+				::std::size_t dim = size(query);
+				
+				this->check(this->bucket.begin(), this->bucket.end(), search);
+				
+				for (::std::size_t i = 0; i < this->trees.size(); ++i)
+				{
+					if (!this->trees[i].nodes.empty())
+					{
+						::std::size_t sidedist = search.sidedists.size();
+						search.sidedists.resize(sidedist + dim, Distance());
+						this->search(this->trees[i], 0, Distance(), sidedist, search);
+					}
+				}
+				
+				while (!search.branches.empty() && (!this->checks || search.checks < this->checks))
+				{
+					Branch branch = search.branches.front();
+					::std::pop_heap(search.branches.begin(), search.branches.end(), BranchCompare());
+					search.branches.pop_back();
+					
+					if (nullptr != k && search.neighbors.size() == *k && branch.dist * (1 + this->epsilon) > search.neighbors.front().first)
+					{
+						continue;
+					}
+					
+					this->search(*branch.tree, branch.node, branch.dist, branch.sidedist, search);
+				}
+				
+				if (sorted)
+				{
+					::std::sort_heap(search.neighbors.begin(), search.neighbors.end(), NeighborCompare());
+				}
+				
+				return search.neighbors;
+			}
+			
+			void search(const Tree& tree, const ::std::size_t& n, const Distance& mindist, const ::std::size_t& sidedist, Search& search) const
+			{
+				using ::std::begin;
+				using ::rl::std17::size;
+				
+				const Node& node = tree.nodes[n];
+				
+				if (0 == node.right)
+				{
+					this->check(tree.values.begin() + node.begin, tree.values.begin() + node.end, search);
+					
+					return;
+				}
+				
+				Distance value = *(begin(*search.query) + node.index);
+				Distance diff = value - node.value;
+				
+				::std::size_t best = diff < 0 ? n + 1 : node.right;
+				::std::size_t worst = diff < 0 ? node.right : n + 1;
+				
+				this->search(tree, best, mindist, sidedist, search);
+				
+				Distance cutdist = this->metric(value, node.value, node.index);
+				Distance newdist = mindist - search.sidedists[sidedist + node.index] + cutdist;
+				
+				if (nullptr == search.k || search.neighbors.size() < *search.k || newdist * (1 + this->epsilon) <= search.neighbors.front().first)
+				{
+					if (!this->checks)
+					{
+						Distance dist = search.sidedists[sidedist + node.index];
+						search.sidedists[sidedist + node.index] = cutdist;
+						this->search(tree, worst, newdist, sidedist, search);
+						search.sidedists[sidedist + node.index] = dist;
+					}
+					else
+					{
+						// side distances of deferred branch stored in shared buffer
+						
+						Branch branch;
+						branch.dist = newdist;
+						branch.node = worst;
+						branch.sidedist = search.sidedists.size();
+						branch.tree = &tree;
+						
+						::std::size_t dim = size(*search.query);
+						
+						for (::std::size_t i = 0; i < dim; ++i)
+						{
+							search.sidedists.push_back(search.sidedists[sidedist + i]);
+						}
+						
+						search.sidedists[branch.sidedist + node.index] = cutdist;
+						
+						search.branches.push_back(branch);
+						::std::push_heap(search.branches.begin(), search.branches.end(), BranchCompare());
+					}
+				}
+			}
+			
+			::std::vector<Value> bucket;
+			
+			::std::size_t bucketSize;
+			
+			::boost::optional<::std::size_t> checks;
+			
+			Distance epsilon;
+			
+			Metric metric;
+			
+			::std::vector<Tree> trees;
+			
+			::std::size_t values;
+		};
+	}
+}
+
+#endif // RL_MATH_KDTREEFLATNEARESTNEIGHBORS_H
@@ -82,6 +82,7 @@ namespace rl
 			
 			explicit KdtreeNearestNeighbors(const Metric& metric) :
 				checks(),
+				epsilon(0),
 				mean(),
 				metric(metric),
 				root(),
@@ -93,6 +94,7 @@ namespace rl
 			
 			explicit KdtreeNearestNeighbors(Metric&& metric = Metric()) :
 				checks(),
+				epsilon(0),
 				mean(),
 				metric(::std::move(metric)),
 				root(),
@@ -105,6 +107,7 @@ namespace rl
 			template<typename InputIterator>
 			KdtreeNearestNeighbors(InputIterator first, InputIterator last, const Metric& metric) :
 				checks(),
+				epsilon(0),
 				mean(),
 				metric(metric),
 				root(),
@@ -118,6 +121,7 @@ namespace rl
 			template<typename InputIterator>
 			KdtreeNearestNeighbors(InputIterator first, InputIterator last, Metric&& metric = Metric()) :
 				checks(),
+				epsilon(0),
 				mean(),
 				metric(::std::move(metric)),
 				root(),
@@ -158,6 +162,11 @@ namespace rl
 				return this->checks;
 			}
 			
+			Distance getEpsilon() const
+			{
+				return this->epsilon;
+			}
+			
 			::std::size_t getSamples() const
 			{
 				return this->samples;
@@ -211,6 +220,11 @@ namespace rl
 				this->checks = checks;
 			}
 			
+			void setEpsilon(const Distance& epsilon)
+			{
+				this->epsilon = epsilon;
+			}
+			
 			void setSamples(const ::std::size_t& samples)
 			{
 				this->samples = samples;
@@ -225,6 +239,7 @@ namespace rl
 			{
 				using ::std::swap;
 				swap(this->mean, other.mean);
+				swap(this->epsilon, other.epsilon);
 				swap(this->metric, other.metric);
 				swap(this->samples, other.samples);
 				swap(this->root, other.root);
@@ -491,7 +506,7 @@ namespace rl
 					Distance cutdist = this->metric(value, node.cut.value, node.cut.index);
 					Distance newdist = mindist - sidedist[node.cut.index] + cutdist;
 					
-					if (nullptr == k || neighbors.size() < *k || newdist <= neighbors.front().first)
+					if (nullptr == k || neighbors.size() < *k || newdist * (1 + this->epsilon) <= neighbors.front().first)
 					{
 						if (!this->checks)
 						{
@@ -560,6 +575,8 @@ namespace rl
 			
 			::boost::optional<::std::size_t> checks;
 			
+			Distance epsilon;
+			
 			::std::vector<Distance> mean;
 			
 			Metric metric;
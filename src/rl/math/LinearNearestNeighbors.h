@@ -30,6 +30,8 @@
 #include <algorithm>
 #include <vector>
 
+#include "metrics/distances.h"
+
 namespace rl
 {
 	namespace math
@@ -258,6 +260,10 @@ namespace rl
 					neighbors.reserve(::std::min(*k, this->size()));
 				}
 				
+				// distances computed block-wise on the stack within each thread
+				
+				const ::std::size_t block = 256;
+				
 #ifdef _OPENMP
 				::std::vector<::std::vector<Neighbor>> neighbors2(::omp_get_max_threads());
 				
@@ -271,34 +277,39 @@ namespace rl
 				
 #pragma omp parallel for
 #if _OPENMP < 200805
-				for (::std::ptrdiff_t i = 0; i < this->container.size(); ++i)
+				for (::std::ptrdiff_t i = 0; i < this->container.size(); i += block)
 #else
-				for (::std::size_t i = 0; i < this->container.size(); ++i)
+				for (::std::size_t i = 0; i < this->container.size(); i += block)
 #endif
 #else
 				::std::vector<Neighbor>& neighbors3 = neighbors;
 				
-				for (::std::size_t i = 0; i < this->container.size(); ++i)
+				for (::std::size_t i = 0; i < this->container.size(); i += block)
 #endif
 				{
 #ifdef _OPENMP
 					::std::vector<Neighbor>& neighbors3 = neighbors2[::omp_get_thread_num()];
 #endif
 					
-					Distance distance = this->metric(query, this->container[i]);
+					Distance distances[block];
+					::std::size_t count = ::std::min<::std::size_t>(block, this->container.size() - i);
+					::rl::math::metrics::distances(this->metric, query, this->container.begin() + i, this->container.begin() + i + count, distances);
 					
-					if (nullptr == k || neighbors3.size() < *k || distance < neighbors3.front().first)
+					for (::std::size_t j = 0; j < count; ++j)
 					{
-						if (nullptr == radius || distance < *radius)
+						if (nullptr == k || neighbors3.size() < *k || distances[j] < neighbors3.front().first)
 						{
-							if (nullptr != k && *k == neighbors3.size())
+							if (nullptr == radius || distances[j] < *radius)
 							{
-								::std::pop_heap(neighbors3.begin(), neighbors3.end(), NeighborCompare());
-								neighbors3.pop_back();
+								if (nullptr != k && *k == neighbors3.size())
+								{
+									::std::pop_heap(neighbors3.begin(), neighbors3.end(), NeighborCompare());
+									neighbors3.pop_back();
+								}
+								
+								neighbors3.emplace_back(distances[j], this->container[i + j]);
+								::std::push_heap(neighbors3.begin(), neighbors3.end(), NeighborCompare());
 							}
-							
-							neighbors3.emplace_back(distance, this->container[i]);
-							::std::push_heap(neighbors3.begin(), neighbors3.end(), NeighborCompare());
 						}
 					}
 				}
@@ -31,6 +31,7 @@
 #define EIGEN_QUATERNIONBASE_PLUGIN <rl/math/QuaternionBaseAddons.h>
 #define EIGEN_TRANSFORM_PLUGIN <rl/math/TransformAddons.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <stdexcept>
@@ -42,6 +43,7 @@
 #include <Eigen/Eigenvalues>
 #endif // HAVE_EIGEN_UNSUPPORTED
 
+#include "Array.h"
 #include "Constants.h"
 #include "Function.h"
 #include "Matrix.h"
@@ -573,22 +575,37 @@ namespace rl
 			
 			T operator()(const Real& x, const ::std::size_t& derivative = 0) const
 			{
-				if (derivative > 0)
+				assert(x > this->lower() - this->functionBoundary);
+				assert(x < this->upper() + this->functionBoundary);
+				
+				if (derivative > this->degree())
+				{
+					return TypeTraits<T>::Zero(TypeTraits<T>::size(this->c[0]));
+				}
+				else if (derivative > 0)
 				{
-					Polynomial f = this->derivative();
+					// Horner's scheme on coefficients of derivative i * (i - 1) * ... * (i - derivative + 1) * c[i]
+					
+					Real factor = 1;
+					
+					for (::std::size_t i = 0; i < derivative; ++i)
+					{
+						factor *= static_cast<Real>(this->degree() - i);
+					}
+					
+					T y = factor * this->c[this->degree()];
 					
-					for (::std::size_t i = 1; i < derivative; ++i)
+					for (::std::size_t i = this->degree(); i > derivative; --i)
 					{
-						f = f.derivative();
+						factor *= static_cast<Real>(i - derivative) / static_cast<Real>(i);
+						y *= x;
+						y += factor * this->c[i - 1];
 					}
 					
-					return f(x);
+					return y;
 				}
 				else
 				{
-					assert(x > this->lower() - this->functionBoundary);
-					assert(x < this->upper() + this->functionBoundary);
-					
 					T y = this->c[this->degree()];
 					
 					for (::std::size_t i = 1; i < this->degree() + 1; ++i)
@@ -601,6 +618,108 @@ namespace rl
 				}
 			}
 			
+			/**
+			 * Evaluates function value and derivatives in a single pass.
+			 *
+			 * Sets y[0] to f(x) and y[i] to the derivative of order i, up to
+			 * y.size() - 1, e.g., position, velocity, acceleration, and jerk for
+			 * a vector of size four. Uses Horner's scheme on the coefficients
+			 * without creating derivative polynomials, so no memory is allocated
+			 * if the elements of y already have the correct size.
+			 */
+			void operator()(const Real& x, ::std::vector<T>& y) const
+			{
+				assert(x > this->lower() - this->functionBoundary);
+				assert(x < this->upper() + this->functionBoundary);
+				assert(y.size() > 0);
+				
+				y[0] = this->c[this->degree()];
+				
+				for (::std::size_t i = 1; i < y.size(); ++i)
+				{
+					y[i] = 0 * this->c[this->degree()];
+				}
+				
+				for (::std::size_t i = this->degree(); i > 0; --i)
+				{
+					for (::std::size_t j = ::std::min(y.size() - 1, this->degree() - i + 1); j > 0; --j)
+					{
+						y[j] *= x;
+						y[j] += y[j - 1];
+					}
+					
+					y[0] *= x;
+					y[0] += this->c[i - 1];
+				}
+				
+				Real factorial = 1;
+				
+				for (::std::size_t i = 2; i < y.size(); ++i)
+				{
+					factorial *= static_cast<Real>(i);
+					y[i] *= factorial;
+				}
+			}
+			
+			/**
+			 * Evaluates the polynomial at several points.
+			 *
+			 * Sets row k of y to the derivative of given order at x[k], with one
+			 * column per dimension of T. Each step of Horner's scheme is applied
+			 * to all points at once, so that the inner loop runs over contiguous
+			 * points and can be vectorized independent of the dimension of T.
+			 */
+			void operator()(const ::Eigen::Ref<const ArrayX>& x, MatrixRef y, const ::std::size_t& derivative = 0) const
+			{
+				assert((x > this->lower() - this->functionBoundary).all());
+				assert((x < this->upper() + this->functionBoundary).all());
+				assert(y.rows() == x.size());
+				assert(y.cols() == static_cast<::std::ptrdiff_t>(TypeTraits<T>::size(this->c[0])));
+				
+				if (derivative > this->degree())
+				{
+					y.setZero();
+					return;
+				}
+				
+				Real factor = 1;
+				
+				for (::std::size_t i = 0; i < derivative; ++i)
+				{
+					factor *= static_cast<Real>(this->degree() - i);
+				}
+				
+				for (::std::ptrdiff_t j = 0; j < y.cols(); ++j)
+				{
+					Real f = factor;
+					y.col(j).setConstant(f * element(this->c[this->degree()], j));
+					
+					for (::std::size_t i = this->degree(); i > derivative; --i)
+					{
+						f *= static_cast<Real>(i - derivative) / static_cast<Real>(i);
+						y.col(j).array() = y.col(j).array() * x + f * element(this->c[i - 1], j);
+					}
+				}
+			}
+			
+			/**
+			 * Evaluates function value and derivatives at several points.
+			 *
+			 * Resizes y[i] to one row per point and sets it to the derivative of
+			 * order i, e.g., position, velocity, and acceleration for a vector of
+			 * size three.
+			 *
+			 * @see operator()(const ::Eigen::Ref<const ArrayX>&, MatrixRef, const ::std::size_t&) const
+			 */
+			void operator()(const ::Eigen::Ref<const ArrayX>& x, ::std::vector<Matrix>& y) const
+			{
+				for (::std::size_t i = 0; i < y.size(); ++i)
+				{
+					y[i].resize(x.size(), TypeTraits<T>::size(this->c[0]));
+					(*this)(x, y[i], i);
+				}
+			}
+			
 			friend Polynomial operator+(const T& lhs, const Polynomial& rhs)
 			{
 				return Polynomial(rhs) += lhs;
@@ -945,7 +1064,16 @@ namespace rl
 			::std::vector<T> c;
 			
 		private:
+			static Real element(const Real& t, const ::std::ptrdiff_t& i)
+			{
+				return t;
+			}
 			
+			template<typename U>
+			static Real element(const U& t, const ::std::ptrdiff_t& i)
+			{
+				return t[i];
+			}
 		};
 	}
 }
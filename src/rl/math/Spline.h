@@ -27,10 +27,13 @@
 #ifndef RL_MATH_SPLINE_H
 #define RL_MATH_SPLINE_H
 
+#include <algorithm>
 #include <limits>
 #include <vector>
 
+#include "Array.h"
 #include "Function.h"
+#include "Matrix.h"
 #include "Polynomial.h"
 
 namespace rl
@@ -57,8 +60,72 @@ namespace rl
 			
 			typedef typename ::std::vector<Polynomial<T>>::reverse_iterator ReverseIterator;
 			
+			/**
+			 * Sequential evaluation of a spline.
+			 *
+			 * Remembers the segment of the last evaluation, so that evaluating at
+			 * monotonically increasing x only advances to the next segment when
+			 * required. Evaluating at a smaller x falls back to a binary search.
+			 * The spline must not be modified while a cursor is in use.
+			 */
+			class Cursor
+			{
+			public:
+				explicit Cursor(const Spline& spline) :
+					i(0),
+					spline(&spline)
+				{
+				}
+				
+				T operator()(const Real& x, const ::std::size_t& derivative = 0)
+				{
+					::std::size_t i = this->advance(x);
+					
+					return this->spline->polynomials[i](x - this->spline->lower() - (i > 0 ? this->spline->breakpoints[i - 1] : 0), derivative);
+				}
+				
+				/**
+				 * Evaluates function value and derivatives in a single pass.
+				 *
+				 * @see Polynomial::operator()(const Real&, ::std::vector<T>&) const
+				 */
+				void operator()(const Real& x, ::std::vector<T>& y)
+				{
+					::std::size_t i = this->advance(x);
+					
+					this->spline->polynomials[i](x - this->spline->lower() - (i > 0 ? this->spline->breakpoints[i - 1] : 0), y);
+				}
+				
+				/**
+				 * Index of the polynomial used in the last evaluation.
+				 */
+				::std::size_t segment() const
+				{
+					return this->i;
+				}
+				
+			protected:
+				
+			private:
+				::std::size_t advance(const Real& x)
+				{
+					assert(x >= this->spline->lower() - this->spline->functionBoundary);
+					assert(x <= this->spline->upper() + this->spline->functionBoundary);
+					assert(this->spline->polynomials.size() > 0);
+					
+					this->i = this->spline->segment(x, this->i);
+					
+					return this->i;
+				}
+				
+				::std::size_t i;
+				
+				const Spline* spline;
+			};
+			
 			Spline() :
 				Function<T>(0, 0),
+				breakpoints(),
 				polynomials()
 			{
 			}
@@ -1121,6 +1188,7 @@ namespace rl
 			
 			void clear()
 			{
+				this->breakpoints.clear();
 				this->polynomials.clear();
 				this->x0 = 0;
 				this->x1 = 0;
@@ -1257,15 +1325,74 @@ namespace rl
 				assert(x <= this->upper() + this->functionBoundary);
 				assert(this->polynomials.size() > 0);
 				
-				Real x0 = this->lower();
-				::std::size_t i = 0;
+				::std::size_t i = this->segment(x);
+				
+				return this->polynomials[i](x - this->lower() - (i > 0 ? this->breakpoints[i - 1] : 0), derivative);
+			}
+			
+			/**
+			 * Evaluates function value and derivatives in a single pass.
+			 *
+			 * @see Polynomial::operator()(const Real&, ::std::vector<T>&) const
+			 */
+			void operator()(const Real& x, ::std::vector<T>& y) const
+			{
+				assert(x >= this->lower() - this->functionBoundary);
+				assert(x <= this->upper() + this->functionBoundary);
+				assert(this->polynomials.size() > 0);
+				
+				::std::size_t i = this->segment(x);
+				
+				this->polynomials[i](x - this->lower() - (i > 0 ? this->breakpoints[i - 1] : 0), y);
+			}
+			
+			/**
+			 * Evaluates the spline at several points.
+			 *
+			 * Sets row k of y to the derivative of given order at x[k], with one
+			 * column per dimension of T. The points are grouped by polynomial and
+			 * each group is evaluated at once, see
+			 * Polynomial::operator()(const ::Eigen::Ref<const ArrayX>&, MatrixRef, const ::std::size_t&) const.
+			 * Sorted points are looked up sequentially and evaluated in place,
+			 * unsorted points are additionally bucketed by polynomial.
+			 */
+			void operator()(const ::Eigen::Ref<const ArrayX>& x, MatrixRef y, const ::std::size_t& derivative = 0) const
+			{
+				assert(y.rows() == x.size());
+				
+				::std::vector<::std::ptrdiff_t> index;
+				::std::vector<::std::size_t> segments;
+				ArrayX t;
+				
+				this->group(x, index, segments, t);
+				this->evaluate(index, segments, t, y, derivative);
+			}
+			
+			/**
+			 * Evaluates function value and derivatives at several points.
+			 *
+			 * Resizes y[i] to one row per point and sets it to the derivative of
+			 * order i, e.g., position, velocity, and acceleration for a vector of
+			 * size three. The points are grouped by polynomial only once for all
+			 * derivatives.
+			 *
+			 * @see operator()(const ::Eigen::Ref<const ArrayX>&, MatrixRef, const ::std::size_t&) const
+			 */
+			void operator()(const ::Eigen::Ref<const ArrayX>& x, ::std::vector<Matrix>& y) const
+			{
+				assert(this->polynomials.size() > 0);
+				
+				::std::vector<::std::ptrdiff_t> index;
+				::std::vector<::std::size_t> segments;
+				ArrayX t;
+				
+				this->group(x, index, segments, t);
 				
-				for (; x > x0 + this->polynomials[i].duration() && i + 1 < this->polynomials.size(); ++i)
+				for (::std::size_t i = 0; i < y.size(); ++i)
 				{
-					x0 += this->polynomials[i].duration();
+					y[i].resize(x.size(), TypeTraits<T>::size(this->polynomials.front().coefficient(0)));
+					this->evaluate(index, segments, t, y[i], i);
 				}
-				
-				return this->polynomials[i](x - x0, derivative);
 			}
 			
 			Polynomial<T>& operator[](const ::std::size_t& i)
@@ -1283,6 +1410,7 @@ namespace rl
 				if (!this->polynomials.empty())
 				{
 					this->x1 -= this->polynomials.back().duration();
+					this->breakpoints.pop_back();
 					this->polynomials.pop_back();
 					
 					if (this->polynomials.empty())
@@ -1299,6 +1427,7 @@ namespace rl
 					this->x0 = polynomial.lower();
 				}
 				
+				this->breakpoints.push_back((this->breakpoints.empty() ? 0 : this->breakpoints.back()) + polynomial.duration());
 				this->polynomials.push_back(polynomial);
 				this->x1 += polynomial.duration();
 			}
@@ -1331,6 +1460,21 @@ namespace rl
 				return spline;
 			}
 			
+			/**
+			 * Index of the polynomial that defines the spline at x.
+			 *
+			 * Uses a binary search over the cumulative durations of the
+			 * polynomials. At a breakpoint, the earlier polynomial is chosen.
+			 */
+			::std::size_t segment(const Real& x) const
+			{
+				assert(this->polynomials.size() > 0);
+				
+				::std::size_t i = ::std::lower_bound(this->breakpoints.begin(), this->breakpoints.end(), x - this->lower()) - this->breakpoints.begin();
+				
+				return ::std::min(i, this->polynomials.size() - 1);
+			}
+			
 			::std::size_t size() const
 			{
 				return this->polynomials.size();
@@ -1357,10 +1501,139 @@ namespace rl
 			}
 			
 		protected:
+			/** Cumulative duration up to the end of each polynomial. */
+			::std::vector<Real> breakpoints;
+			
 			::std::vector<Polynomial<T>> polynomials;
 			
 		private:
+			/**
+			 * Evaluates grouped points.
+			 *
+			 * Consecutive points that share a polynomial are evaluated at once,
+			 * the results are written to the rows given by index if not empty.
+			 */
+			void evaluate(const ::std::vector<::std::ptrdiff_t>& index, const ::std::vector<::std::size_t>& segments, const ArrayX& t, MatrixRef y, const ::std::size_t& derivative) const
+			{
+				if (!index.empty())
+				{
+					Matrix z(y.rows(), y.cols());
+					this->evaluate(::std::vector<::std::ptrdiff_t>(), segments, t, z, derivative);
+					
+					for (::std::size_t k = 0; k < index.size(); ++k)
+					{
+						y.row(index[k]) = z.row(k);
+					}
+					
+					return;
+				}
+				
+				::std::ptrdiff_t begin = 0;
+				
+				while (begin < t.size())
+				{
+					::std::ptrdiff_t end = begin + 1;
+					
+					while (end < t.size() && segments[end] == segments[begin])
+					{
+						++end;
+					}
+					
+					this->polynomials[segments[begin]](t.segment(begin, end - begin), y.middleRows(begin, end - begin), derivative);
+					begin = end;
+				}
+			}
 			
+			/**
+			 * Groups points by polynomial.
+			 *
+			 * Sets segments to the polynomial of each point and t to the point
+			 * relative to the start of its polynomial. Sorted points keep their
+			 * order and leave index empty, otherwise the points are bucketed by
+			 * polynomial in linear time and index maps each entry to its point.
+			 */
+			void group(const ::Eigen::Ref<const ArrayX>& x, ::std::vector<::std::ptrdiff_t>& index, ::std::vector<::std::size_t>& segments, ArrayX& t) const
+			{
+				assert((x >= this->lower() - this->functionBoundary).all());
+				assert((x <= this->upper() + this->functionBoundary).all());
+				assert(this->polynomials.size() > 0);
+				
+				segments.resize(x.size());
+				bool sorted = true;
+				
+				for (::std::ptrdiff_t k = 0; k < x.size(); ++k)
+				{
+					segments[k] = this->segment(x[k], k > 0 ? segments[k - 1] : 0);
+					sorted = sorted && (0 == k || segments[k] >= segments[k - 1]);
+				}
+				
+				t.resize(x.size());
+				
+				if (sorted)
+				{
+					index.clear();
+					
+					for (::std::ptrdiff_t k = 0; k < x.size(); ++k)
+					{
+						t[k] = x[k] - this->lower() - (segments[k] > 0 ? this->breakpoints[segments[k] - 1] : 0);
+					}
+				}
+				else
+				{
+					::std::vector<::std::size_t> offsets(this->polynomials.size() + 1, 0);
+					
+					for (::std::ptrdiff_t k = 0; k < x.size(); ++k)
+					{
+						++offsets[segments[k] + 1];
+					}
+					
+					for (::std::size_t i = 1; i < offsets.size(); ++i)
+					{
+						offsets[i] += offsets[i - 1];
+					}
+					
+					index.resize(x.size());
+					
+					for (::std::ptrdiff_t k = 0; k < x.size(); ++k)
+					{
+						index[offsets[segments[k]]++] = k;
+					}
+					
+					for (::std::size_t k = 0; k < index.size(); ++k)
+					{
+						segments[k] = this->segment(x[index[k]], k > 0 ? segments[k - 1] : 0);
+						t[k] = x[index[k]] - this->lower() - (segments[k] > 0 ? this->breakpoints[segments[k] - 1] : 0);
+					}
+				}
+			}
+			
+			/**
+			 * Index of the polynomial that defines the spline at x, starting at i.
+			 *
+			 * Checks the polynomials i and i + 1 before falling back to a binary
+			 * search, which makes lookups of increasing x constant on average.
+			 */
+			::std::size_t segment(const Real& x, const ::std::size_t& i) const
+			{
+				Real t = x - this->lower();
+				
+				if (i > 0 && t <= this->breakpoints[i - 1])
+				{
+					return this->segment(x);
+				}
+				else if (t <= this->breakpoints[i] || i + 1 == this->polynomials.size())
+				{
+					return i;
+				}
+				else if (t <= this->breakpoints[i + 1] || i + 2 == this->polynomials.size())
+				{
+					return i + 1;
+				}
+				else
+				{
+					return this->segment(x);
+				}
+			}
 		};
 	}
 }
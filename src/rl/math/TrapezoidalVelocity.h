@@ -31,6 +31,7 @@
 #include <cmath>
 #include <limits>
 
+#include "Array.h"
 #include "Real.h"
 
 namespace rl
@@ -81,6 +82,22 @@ namespace rl
 				}
 			}
 			
+			/**
+			 * Evaluates the acceleration at several points in time.
+			 *
+			 * The phases are selected per element instead of per branch, so that
+			 * the evaluation can be vectorized.
+			 */
+			void a(const ::Eigen::Ref<const ArrayX>& t, ::Eigen::Ref<ArrayX> y) const
+			{
+				assert(y.size() == t.size());
+				
+				y = (t < ta).select(
+					ah,
+					(t >= ta + tc && t < ta + tc + td).select(-dh, ArrayX::Zero(t.size()))
+				);
+			}
+			
 			void interpolate()
 			{
 				T x = xe - x0;
@@ -720,6 +737,27 @@ namespace rl
 				}
 			}
 			
+			/**
+			 * Evaluates the velocity at several points in time.
+			 *
+			 * @see a(const ::Eigen::Ref<const ArrayX>&, ::Eigen::Ref<ArrayX>) const
+			 */
+			void v(const ::Eigen::Ref<const ArrayX>& t, ::Eigen::Ref<ArrayX> y) const
+			{
+				assert(y.size() == t.size());
+				
+				y = (t < ta).select(
+					v0 + ah * t,
+					(t < ta + tc).select(
+						v0 + ah * ta,
+						(t < ta + tc + td).select(
+							v0 + ah * ta - dh * t + dh * (ta + tc),
+							ve
+						)
+					)
+				);
+			}
+			
 			T x(const Real& t) const
 			{
 				if (t < ta)
@@ -740,6 +778,27 @@ namespace rl
 				}
 			}
 			
+			/**
+			 * Evaluates the position at several points in time.
+			 *
+			 * @see a(const ::Eigen::Ref<const ArrayX>&, ::Eigen::Ref<ArrayX>) const
+			 */
+			void x(const ::Eigen::Ref<const ArrayX>& t, ::Eigen::Ref<ArrayX> y) const
+			{
+				assert(y.size() == t.size());
+				
+				y = (t < ta).select(
+					x0 + v0 * t + 0.5 * ah * t.square(),
+					(t < ta + tc).select(
+						x0 + v0 * t - 0.5 * ah * ::std::pow(ta, 2) + ah * ta * t,
+						(t < ta + tc + td).select(
+							x0 + v0 * t - 0.5 * ah * ::std::pow(ta, 2) + ah * ta * t - 0.5 * dh * ::std::pow(ta + tc, 2) - 0.5 * dh * t.square() + dh * (ta + tc) * t,
+							xe + ve * (t - ta - tc - td)
+						)
+					)
+				);
+			}
+			
 			T am;
 			
 			T dm;
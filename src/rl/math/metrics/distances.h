@@ -0,0 +1,70 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef RL_MATH_METRICS_DISTANCES_H
+#define RL_MATH_METRICS_DISTANCES_H
+
+namespace rl
+{
+	namespace math
+	{
+		namespace metrics
+		{
+			namespace detail
+			{
+				template<typename MetricT, typename InputIterator>
+				auto distances(const MetricT& metric, const typename MetricT::Value& query, InputIterator first, InputIterator last, typename MetricT::Distance* distances, int) -> decltype(metric(query, first, last, distances), void())
+				{
+					metric(query, first, last, distances);
+				}
+				
+				template<typename MetricT, typename InputIterator>
+				void distances(const MetricT& metric, const typename MetricT::Value& query, InputIterator first, InputIterator last, typename MetricT::Distance* distances, long)
+				{
+					for (; first != last; ++first, ++distances)
+					{
+						*distances = metric(query, *first);
+					}
+				}
+			}
+			
+			/**
+			 * Distances of a query to a range of values.
+			 * 
+			 * Uses the batch operator <code>metric(query, first, last, distances)</code>
+			 * if the metric provides one and calls <code>metric(query, value)</code>
+			 * for each value otherwise.
+			 */
+			template<typename MetricT, typename InputIterator>
+			void distances(const MetricT& metric, const typename MetricT::Value& query, InputIterator first, InputIterator last, typename MetricT::Distance* distances)
+			{
+				detail::distances(metric, query, first, last, distances, 0);
+			}
+		}
+	}
+}
+
+#endif // RL_MATH_METRICS_DISTANCES_H
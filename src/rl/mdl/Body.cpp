@@ -47,6 +47,12 @@ namespace rl
 		{
 		}
 		
+		void
+		Body::compositeRigidBody1()
+		{
+			this->iC = this->i;
+		}
+		
 		void
 		Body::forwardAcceleration()
 		{
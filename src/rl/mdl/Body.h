@@ -42,6 +42,8 @@ namespace rl
 			
 			virtual ~Body();
 			
+			void compositeRigidBody1();
+			
 			void forwardAcceleration();
 			
 			void forwardDynamics1();
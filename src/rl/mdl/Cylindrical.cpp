@@ -54,11 +54,10 @@ namespace rl
 		}
 		
 		void
-		Cylindrical::setPosition(const ::rl::math::ConstVectorRef& q)
+		Cylindrical::calculateTransform(const ::rl::math::ConstVectorRef& q, ::rl::math::PlueckerTransform& x) const
 		{
-			this->q = q;
-			this->x.linear() = ::rl::math::AngleAxis(this->q(0) + this->offset(0), this->S.block<3, 1>(0, 0)).toRotationMatrix();
-			this->x.translation() = this->S.block<3, 1>(3, 1) * (this->q(1) + this->offset(1));
+			x.linear() = ::rl::math::AngleAxis(q(0) + this->offset(0), this->S.block<3, 1>(0, 0)).toRotationMatrix();
+			x.translation() = this->S.block<3, 1>(3, 1) * (q(1) + this->offset(1));
 		}
 	}
 }
@@ -0,0 +1,101 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+
+#include "Data.h"
+#include "Joint.h"
+#include "Model.h"
+
+namespace rl
+{
+	namespace mdl
+	{
+		Data::Data() :
+			a(),
+			c(),
+			D(),
+			f(),
+			fX(),
+			iA(),
+			J(),
+			pA(),
+			q(),
+			qd(),
+			qdd(),
+			tau(),
+			u(),
+			U(),
+			v(),
+			x(),
+			X()
+		{
+		}
+		
+		Data::Data(const Model& model) :
+			Data()
+		{
+			this->resize(model);
+		}
+		
+		Data::~Data()
+		{
+		}
+		
+		void
+		Data::resize(const Model& model)
+		{
+			this->a.assign(model.getFrames(), ::rl::math::MotionVector::Zero());
+			this->c.assign(model.getFrames(), ::rl::math::MotionVector::Zero());
+			this->D.resize(model.getTransforms());
+			this->f.assign(model.getFrames(), ::rl::math::ForceVector::Zero());
+			this->fX.assign(model.getFrames(), ::rl::math::ForceVector::Zero());
+			this->iA.assign(model.getFrames(), ::rl::math::ArticulatedBodyInertia::Zero());
+			this->J = ::rl::math::Matrix::Zero(6 * model.getOperationalDof(), model.getDof());
+			this->pA.assign(model.getFrames(), ::rl::math::ForceVector::Zero());
+			this->q = model.getHomePosition();
+			this->qd = ::rl::math::Vector::Zero(model.getDof());
+			this->qdd = ::rl::math::Vector::Zero(model.getDof());
+			this->tau = ::rl::math::Vector::Zero(model.getDof());
+			this->u.resize(model.getTransforms());
+			this->U.resize(model.getTransforms());
+			this->v.assign(model.getFrames(), ::rl::math::MotionVector::Zero());
+			this->x.assign(model.getFrames(), ::rl::math::PlueckerTransform::Identity());
+			this->X.resize(model.getTransforms());
+			
+			for (::std::size_t i = 0; i < model.getTransforms(); ++i)
+			{
+				this->X[i] = model.getTransform(i)->x;
+				
+				if (Joint* joint = dynamic_cast<Joint*>(model.getTransform(i)))
+				{
+					this->D[i] = ::rl::math::Matrix::Zero(joint->getDof(), joint->getDof());
+					this->u[i] = ::rl::math::Vector::Zero(joint->getDof());
+					this->U[i] = ::rl::math::Matrix::Zero(6, joint->getDof());
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,146 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+
+#ifndef RL_MDL_DATA_H
+#define RL_MDL_DATA_H
+
+#include <vector>
+#include <rl/math/Matrix.h>
+#include <rl/math/Spatial.h>
+#include <rl/math/Vector.h>
+#include <rl/mdl/export.h>
+
+namespace rl
+{
+	namespace mdl
+	{
+		class Model;
+		
+		/**
+		 * Workspace for evaluating a model.
+		 *
+		 * Contains all quantities that are modified by the kinematic and
+		 * dynamic algorithms taking a workspace argument, while the model only
+		 * provides its topology and parameters. One model can therefore be
+		 * evaluated concurrently by several threads, each with its own
+		 * workspace.
+		 *
+		 * Frame quantities are indexed like Model::getFrame(), transform
+		 * quantities like Model::getTransform().
+		 */
+		class RL_MDL_EXPORT Data
+		{
+		public:
+			Data();
+			
+			Data(const Model& model);
+			
+			virtual ~Data();
+			
+			/**
+			 * Allocate workspace for model.
+			 *
+			 * Has to be called again after Model::update().
+			 */
+			void resize(const Model& model);
+			
+			/**
+			 * Spatial acceleration of frames.
+			 */
+			::std::vector<::rl::math::MotionVector, ::Eigen::aligned_allocator<::rl::math::MotionVector>> a;
+			
+			::std::vector<::rl::math::MotionVector, ::Eigen::aligned_allocator<::rl::math::MotionVector>> c;
+			
+			::std::vector<::rl::math::Matrix> D;
+			
+			/**
+			 * Spatial force of frames.
+			 */
+			::std::vector<::rl::math::ForceVector, ::Eigen::aligned_allocator<::rl::math::ForceVector>> f;
+			
+			/**
+			 * External spatial force acting on bodies.
+			 */
+			::std::vector<::rl::math::ForceVector, ::Eigen::aligned_allocator<::rl::math::ForceVector>> fX;
+			
+			::std::vector<::rl::math::ArticulatedBodyInertia, ::Eigen::aligned_allocator<::rl::math::ArticulatedBodyInertia>> iA;
+			
+			/**
+			 * Jacobian matrix.
+			 */
+			::rl::math::Matrix J;
+			
+			::std::vector<::rl::math::ForceVector, ::Eigen::aligned_allocator<::rl::math::ForceVector>> pA;
+			
+			/**
+			 * Generalized position.
+			 */
+			::rl::math::Vector q;
+			
+			/**
+			 * Generalized velocity.
+			 */
+			::rl::math::Vector qd;
+			
+			/**
+			 * Generalized acceleration.
+			 */
+			::rl::math::Vector qdd;
+			
+			/**
+			 * Joint torque.
+			 */
+			::rl::math::Vector tau;
+			
+			::std::vector<::rl::math::Vector> u;
+			
+			::std::vector<::rl::math::Matrix> U;
+			
+			/**
+			 * Spatial velocity of frames.
+			 */
+			::std::vector<::rl::math::MotionVector, ::Eigen::aligned_allocator<::rl::math::MotionVector>> v;
+			
+			/**
+			 * Pose of frames.
+			 */
+			::std::vector<::rl::math::PlueckerTransform, ::Eigen::aligned_allocator<::rl::math::PlueckerTransform>> x;
+			
+			/**
+			 * Transform of transforms, including current joint positions.
+			 */
+			::std::vector<::rl::math::PlueckerTransform, ::Eigen::aligned_allocator<::rl::math::PlueckerTransform>> X;
+			
+		protected:
+			
+		private:
+			
+		};
+	}
+}
+
+#endif // RL_MDL_DATA_H
@@ -30,9 +30,11 @@
 #include <rl/math/Rotation.h>
 #include <rl/math/Spatial.h>
 
+#include "Body.h"
 #include "EulerCauchyIntegrator.h"
 #include "Exception.h"
 #include "Dynamic.h"
+#include "Joint.h"
 #include "Prismatic.h"
 #include "Revolute.h"
 #include "RungeKuttaNystromIntegrator.h"
@@ -48,7 +50,9 @@ namespace rl
 			invM(),
 			invMx(),
 			M(),
-			V()
+			V(),
+			massMatrixInverseMethod(MassMatrixInverseMethod::articulatedBody),
+			massMatrixMethod(MassMatrixMethod::compositeRigidBody)
 		{
 		}
 		
@@ -56,6 +60,62 @@ namespace rl
 		{
 		}
 		
+		void
+		Dynamic::calculateArticulatedBodyResponse(::rl::math::Matrix& Q, ::std::vector<::Eigen::Matrix<::rl::math::Real, 6, ::Eigen::Dynamic>>& P)
+		{
+			for (::std::vector<Element*>::iterator i = this->elements.begin(); i != this->elements.end(); ++i)
+			{
+				(*i)->forwardDynamics1();
+			}
+			
+			for (::std::vector<Element*>::reverse_iterator i = this->elements.rbegin(); i != this->elements.rend(); ++i)
+			{
+				(*i)->forwardDynamics2();
+			}
+			
+			for (::std::size_t i = this->transforms.size(); i > 0; --i)
+			{
+				::std::size_t k = i - 1;
+				
+				if (this->offsets[k] < this->getDof())
+				{
+					Joint* joint = static_cast<Joint*>(this->transforms[k]);
+					// tau - S^T * p^A
+					Q.middleRows(this->offsets[k], joint->getDof()) -= joint->S.transpose() * P[k];
+					// p^A + U * D^-1 * u
+					P[k] += joint->U * joint->D.inverse() * Q.middleRows(this->offsets[k], joint->getDof());
+				}
+				
+				if (this->parents[k] < this->transforms.size())
+				{
+					// p^A + X^* * p^a
+					P[this->parents[k]] += this->transforms[k]->x.inverseForce() * P[k];
+				}
+			}
+			
+			for (::std::size_t k = 0; k < this->transforms.size(); ++k)
+			{
+				if (this->parents[k] < this->transforms.size())
+				{
+					// X * a
+					P[k] = this->transforms[k]->x.matrixMotion() * P[this->parents[k]];
+				}
+				else
+				{
+					P[k].setZero();
+				}
+				
+				if (this->offsets[k] < this->getDof())
+				{
+					Joint* joint = static_cast<Joint*>(this->transforms[k]);
+					// D^-1 * (u - U^T * a')
+					Q.middleRows(this->offsets[k], joint->getDof()) = joint->D.inverse() * (Q.middleRows(this->offsets[k], joint->getDof()) - joint->U.transpose() * P[k]);
+					// a' + S * qdd
+					P[k] += joint->S * Q.middleRows(this->offsets[k], joint->getDof());
+				}
+			}
+		}
+		
 		void
 		Dynamic::calculateCentrifugalCoriolis()
 		{
@@ -104,6 +164,74 @@ namespace rl
 		
 		void
 		Dynamic::calculateMassMatrix(::rl::math::Matrix& M)
+		{
+			switch (this->massMatrixMethod)
+			{
+			case MassMatrixMethod::compositeRigidBody:
+				this->calculateMassMatrixCompositeRigidBody(M);
+				break;
+			case MassMatrixMethod::inverseDynamics:
+				this->calculateMassMatrixInverseDynamics(M);
+				break;
+			default:
+				break;
+			}
+		}
+		
+		void
+		Dynamic::calculateMassMatrixCompositeRigidBody(::rl::math::Matrix& M)
+		{
+			for (::std::vector<Element*>::iterator i = this->elements.begin(); i != this->elements.end(); ++i)
+			{
+				(*i)->compositeRigidBody1();
+			}
+			
+			for (::std::vector<Element*>::reverse_iterator i = this->elements.rbegin(); i != this->elements.rend(); ++i)
+			{
+				(*i)->compositeRigidBody2();
+			}
+			
+			M.setZero();
+			
+			for (::std::size_t i = 0; i < this->transforms.size(); ++i)
+			{
+				if (this->offsets[i] >= this->getDof())
+				{
+					continue;
+				}
+				
+				Joint* joint = static_cast<Joint*>(this->transforms[i]);
+				
+				for (::std::ptrdiff_t j = 0; j < joint->S.cols(); ++j)
+				{
+					::std::size_t column = this->offsets[i] + j;
+					
+					// I^c * S
+					::rl::math::ForceVector f = joint->out->iC * ::rl::math::MotionVector(joint->S.col(j));
+					
+					// S^T * f
+					M.block(this->offsets[i], column, joint->getDof(), 1) = joint->S.transpose() * f.matrix();
+					
+					for (::std::size_t k = i, l = this->parents[i]; l < this->transforms.size(); k = l, l = this->parents[l])
+					{
+						// X^* * f
+						f = this->transforms[k]->x / f;
+						
+						if (this->offsets[l] < this->getDof())
+						{
+							Joint* parent = static_cast<Joint*>(this->transforms[l]);
+							M.block(this->offsets[l], column, parent->getDof(), 1) = parent->S.transpose() * f.matrix();
+							M.block(column, this->offsets[l], 1, parent->getDof()) = M.block(this->offsets[l], column, parent->getDof(), 1).transpose();
+						}
+					}
+				}
+			}
+			
+			M = M * this->gammaVelocity;
+		}
+		
+		void
+		Dynamic::calculateMassMatrixInverseDynamics(::rl::math::Matrix& M)
 		{
 			::rl::math::Vector3 g = this->getWorldGravity();
 			
@@ -136,6 +264,35 @@ namespace rl
 		
 		void
 		Dynamic::calculateMassMatrixInverse(::rl::math::Matrix& invM)
+		{
+			switch (this->massMatrixInverseMethod)
+			{
+			case MassMatrixInverseMethod::articulatedBody:
+				this->calculateMassMatrixInverseArticulatedBody(invM);
+				break;
+			case MassMatrixInverseMethod::forwardDynamics:
+				this->calculateMassMatrixInverseForwardDynamics(invM);
+				break;
+			default:
+				break;
+			}
+		}
+		
+		void
+		Dynamic::calculateMassMatrixInverseArticulatedBody(::rl::math::Matrix& invM)
+		{
+			::std::vector<::Eigen::Matrix<::rl::math::Real, 6, ::Eigen::Dynamic>> P(
+				this->transforms.size(),
+				::Eigen::Matrix<::rl::math::Real, 6, ::Eigen::Dynamic>::Zero(6, this->getDof())
+			);
+			
+			invM.setIdentity();
+			this->calculateArticulatedBodyResponse(invM, P);
+			invM = this->invGammaVelocity * invM;
+		}
+		
+		void
+		Dynamic::calculateMassMatrixInverseForwardDynamics(::rl::math::Matrix& invM)
 		{
 			::rl::math::Vector3 g = this->getWorldGravity();
 			
@@ -172,6 +329,47 @@ namespace rl
 			invMx = J * invM * J.transpose();
 		}
 		
+		void
+		Dynamic::calculateOperationalMassMatrixInverse(const bool& inWorldFrame)
+		{
+			this->calculateOperationalMassMatrixInverse(this->invMx, inWorldFrame);
+		}
+		
+		void
+		Dynamic::calculateOperationalMassMatrixInverse(::rl::math::Matrix& invMx, const bool& inWorldFrame)
+		{
+			::std::vector<::Eigen::Matrix<::rl::math::Real, 6, ::Eigen::Dynamic>> P(
+				this->transforms.size(),
+				::Eigen::Matrix<::rl::math::Real, 6, ::Eigen::Dynamic>::Zero(6, 6 * this->getOperationalDof())
+			);
+			
+			for (::std::size_t i = 0; i < this->getOperationalDof(); ++i)
+			{
+				if (this->operationalParents[i] < this->transforms.size())
+				{
+					::rl::math::Matrix33 R = inWorldFrame ? ::rl::math::Matrix33(this->getOperationalPosition(i).linear()) : ::rl::math::Matrix33::Identity();
+					// -f^x for unit forces and moments
+					P[this->operationalParents[i]].block<3, 3>(0, 6 * i + 3) = -R.transpose();
+					P[this->operationalParents[i]].block<3, 3>(3, 6 * i) = -R.transpose();
+				}
+			}
+			
+			::rl::math::Matrix Q = ::rl::math::Matrix::Zero(this->getDof(), 6 * this->getOperationalDof());
+			this->calculateArticulatedBodyResponse(Q, P);
+			
+			invMx.setZero();
+			
+			for (::std::size_t i = 0; i < this->getOperationalDof(); ++i)
+			{
+				if (this->operationalParents[i] < this->transforms.size())
+				{
+					::rl::math::Matrix33 R = inWorldFrame ? ::rl::math::Matrix33(this->getOperationalPosition(i).linear()) : ::rl::math::Matrix33::Identity();
+					invMx.middleRows(6 * i, 3) = R * P[this->operationalParents[i]].bottomRows<3>();
+					invMx.middleRows(6 * i + 3, 3) = R * P[this->operationalParents[i]].topRows<3>();
+				}
+			}
+		}
+		
 		void
 		Dynamic::eulerCauchy(const ::rl::math::Real& dt)
 		{
@@ -198,6 +396,104 @@ namespace rl
 			}
 		}
 		
+		void
+		Dynamic::forwardDynamics(Data& data) const
+		{
+			::rl::math::Vector qd = this->gammaVelocity * data.qd;
+			::rl::math::Vector qdd(this->getDof());
+			
+			data.a[0].angular().setZero();
+			data.a[0].linear() = this->getWorldGravity();
+			data.c[0].setZero();
+			data.iA[0].setZero();
+			data.pA[0].setZero();
+			data.v[0].setZero();
+			
+			for (::std::size_t i = 0; i < this->transforms.size(); ++i)
+			{
+				::std::size_t in = this->parents[i] < this->transforms.size() ? this->parents[i] + 1 : 0;
+				
+				// X * v
+				data.v[i + 1] = data.X[i] * data.v[in];
+				data.c[i + 1].setZero();
+				
+				if (this->offsets[i] < this->getDof())
+				{
+					Joint* joint = static_cast<Joint*>(this->transforms[i]);
+					// S * qd
+					::rl::math::MotionVector v(joint->S * qd.segment(this->offsets[i], joint->getDof()));
+					// X * v + vj
+					data.v[i + 1] += v;
+					// v x vj
+					data.c[i + 1] = data.v[i + 1].cross(v);
+				}
+				
+				data.iA[i + 1].setZero();
+				data.pA[i + 1].setZero();
+			}
+			
+			for (::std::size_t i = 0; i < this->bodies.size(); ++i)
+			{
+				::std::size_t k = this->bodyFrames[i];
+				data.iA[k] = this->bodies[i]->i;
+				// v x I * v - X_0 * f^x
+				data.pA[k] = data.v[k].cross(this->bodies[i]->i * data.v[k]) - data.x[k] * data.fX[k];
+			}
+			
+			for (::std::size_t k = this->transforms.size(); k > 0; --k)
+			{
+				::std::size_t i = k - 1;
+				::std::size_t in = this->parents[i] < this->transforms.size() ? this->parents[i] + 1 : 0;
+				
+				if (this->offsets[i] < this->getDof())
+				{
+					Joint* joint = static_cast<Joint*>(this->transforms[i]);
+					// I^A * S
+					data.U[i] = data.iA[i + 1].matrix() * joint->S;
+					// S^T * U
+					data.D[i] = joint->S.transpose() * data.U[i];
+					// tau - S^T * p^A
+					data.u[i] = data.tau.segment(this->offsets[i], joint->getDof()) - joint->S.transpose() * data.pA[i + 1].matrix();
+					// I^A - U * D^-1 * U^T
+					::rl::math::ArticulatedBodyInertia ia(data.iA[i + 1] - ::rl::math::ArticulatedBodyInertia(data.U[i] * data.D[i].inverse() * data.U[i].transpose()));
+					// p^A + I^a * c + U * D^-1 * u
+					::rl::math::ForceVector pa(data.pA[i + 1] + ia * data.c[i + 1] + ::rl::math::ForceVector(data.U[i] * data.D[i].inverse() * data.u[i]));
+					// I^A + X^* * I^a * X
+					data.iA[in] = data.iA[in] + data.X[i] / ia;
+					// p^A + X^* * p^a
+					data.pA[in] = data.pA[in] + data.X[i] / pa;
+				}
+				else
+				{
+					// p^A + I^a * c
+					::rl::math::ForceVector pa(data.pA[i + 1] + data.iA[i + 1] * data.c[i + 1]);
+					// I^A + X^* * I^a * X
+					data.iA[in] = data.iA[in] + data.X[i] / data.iA[i + 1];
+					// p^A + X^* * p^a
+					data.pA[in] = data.pA[in] + data.X[i] / pa;
+				}
+			}
+			
+			for (::std::size_t i = 0; i < this->transforms.size(); ++i)
+			{
+				::std::size_t in = this->parents[i] < this->transforms.size() ? this->parents[i] + 1 : 0;
+				
+				// X * a + c
+				data.a[i + 1] = data.X[i] * data.a[in] + data.c[i + 1];
+				
+				if (this->offsets[i] < this->getDof())
+				{
+					Joint* joint = static_cast<Joint*>(this->transforms[i]);
+					// D^-1 * (u - U^T * a')
+					qdd.segment(this->offsets[i], joint->getDof()) = data.D[i].inverse() * (data.u[i] - data.U[i].transpose() * data.a[i + 1].matrix());
+					// a' + S * qdd
+					data.a[i + 1] += ::rl::math::MotionVector(joint->S * qdd.segment(this->offsets[i], joint->getDof()));
+				}
+			}
+			
+			data.qdd = this->invGammaVelocity * qdd;
+		}
+		
 		const ::rl::math::Vector&
 		Dynamic::getCentrifugalCoriolis() const
 		{
@@ -222,6 +518,18 @@ namespace rl
 			return this->M;
 		}
 		
+		const Dynamic::MassMatrixInverseMethod&
+		Dynamic::getMassMatrixInverseMethod() const
+		{
+			return this->massMatrixInverseMethod;
+		}
+		
+		const Dynamic::MassMatrixMethod&
+		Dynamic::getMassMatrixMethod() const
+		{
+			return this->massMatrixMethod;
+		}
+		
 		const ::rl::math::Matrix&
 		Dynamic::getOperationalMassMatrixInverse() const
 		{
@@ -242,6 +550,64 @@ namespace rl
 			}
 		}
 		
+		void
+		Dynamic::inverseDynamics(Data& data) const
+		{
+			::rl::math::Vector qd = this->gammaVelocity * data.qd;
+			::rl::math::Vector qdd = this->gammaVelocity * data.qdd;
+			
+			data.a[0].angular().setZero();
+			data.a[0].linear() = this->getWorldGravity();
+			data.f[0].setZero();
+			data.v[0].setZero();
+			
+			for (::std::size_t i = 0; i < this->transforms.size(); ++i)
+			{
+				::std::size_t in = this->parents[i] < this->transforms.size() ? this->parents[i] + 1 : 0;
+				
+				// X * v
+				data.v[i + 1] = data.X[i] * data.v[in];
+				// X * a
+				data.a[i + 1] = data.X[i] * data.a[in];
+				
+				if (this->offsets[i] < this->getDof())
+				{
+					Joint* joint = static_cast<Joint*>(this->transforms[i]);
+					// S * qd
+					::rl::math::MotionVector v(joint->S * qd.segment(this->offsets[i], joint->getDof()));
+					// X * v + vj
+					data.v[i + 1] += v;
+					// X * a + S * qdd + v x vj
+					data.a[i + 1] += ::rl::math::MotionVector(joint->S * qdd.segment(this->offsets[i], joint->getDof())) + data.v[i + 1].cross(v);
+				}
+				
+				data.f[i + 1].setZero();
+			}
+			
+			for (::std::size_t i = 0; i < this->bodies.size(); ++i)
+			{
+				::std::size_t k = this->bodyFrames[i];
+				// I * a + v x I * v - X_0 * f^x
+				data.f[k] = this->bodies[i]->i * data.a[k] + data.v[k].cross(this->bodies[i]->i * data.v[k]) - data.x[k] * data.fX[k];
+			}
+			
+			for (::std::size_t k = this->transforms.size(); k > 0; --k)
+			{
+				::std::size_t i = k - 1;
+				::std::size_t in = this->parents[i] < this->transforms.size() ? this->parents[i] + 1 : 0;
+				
+				if (this->offsets[i] < this->getDof())
+				{
+					Joint* joint = static_cast<Joint*>(this->transforms[i]);
+					// S^T * f
+					data.tau.segment(this->offsets[i], joint->getDof()) = joint->S.transpose() * data.f[i + 1].matrix();
+				}
+				
+				// f + X^* * f
+				data.f[in] += data.X[i] / data.f[i + 1];
+			}
+		}
+		
 		void
 		Dynamic::inverseForce()
 		{
@@ -258,6 +624,18 @@ namespace rl
 			integrator.integrate(dt);
 		}
 		
+		void
+		Dynamic::setMassMatrixInverseMethod(const MassMatrixInverseMethod& massMatrixInverseMethod)
+		{
+			this->massMatrixInverseMethod = massMatrixInverseMethod;
+		}
+		
+		void
+		Dynamic::setMassMatrixMethod(const MassMatrixMethod& massMatrixMethod)
+		{
+			this->massMatrixMethod = massMatrixMethod;
+		}
+		
 		void
 		Dynamic::update()
 		{
@@ -27,6 +27,8 @@
 #ifndef RL_MDL_DYNAMIC_H
 #define RL_MDL_DYNAMIC_H
 
+#include <vector>
+
 #include "Kinematic.h"
 
 namespace rl
@@ -36,6 +38,30 @@ namespace rl
 		class RL_MDL_EXPORT Dynamic : public Kinematic
 		{
 		public:
+			enum class MassMatrixMethod
+			{
+				/**
+				 * Composite-rigid-body algorithm.
+				 */
+				compositeRigidBody,
+				/**
+				 * One recursive Newton-Euler pass per column.
+				 */
+				inverseDynamics
+			};
+			
+			enum class MassMatrixInverseMethod
+			{
+				/**
+				 * Articulated-body recursion for all columns at once.
+				 */
+				articulatedBody,
+				/**
+				 * One articulated-body algorithm pass per column.
+				 */
+				forwardDynamics
+			};
+			
 			Dynamic();
 			
 			virtual ~Dynamic();
@@ -90,18 +116,18 @@ namespace rl
 			 * @pre setPosition()
 			 * @post getMassMatrix()
 			 *
-			 * @see inverseDynamics()
+			 * @see setMassMatrixMethod()
 			 */
 			void calculateMassMatrix();
 			
 			/**
 			 * Calculate joint space mass matrix.
 			 *
-			 * @param[out] M Joint space mass matrix \f$\matr{M}^{-1}(\vec{q})\f$
+			 * @param[out] M Joint space mass matrix \f$\matr{M}(\vec{q})\f$
 			 *
 			 * @pre setPosition()
 			 *
-			 * @see inverseDynamics()
+			 * @see setMassMatrixMethod()
 			 */
 			void calculateMassMatrix(::rl::math::Matrix& M);
 			
@@ -111,7 +137,7 @@ namespace rl
 			 * @pre setPosition()
 			 * @post getMassMatrixInverse()
 			 *
-			 * @see forwardDynamics()
+			 * @see setMassMatrixInverseMethod()
 			 */
 			void calculateMassMatrixInverse();
 			
@@ -122,7 +148,7 @@ namespace rl
 			 *
 			 * @pre setPosition()
 			 *
-			 * @see forwardDynamics()
+			 * @see setMassMatrixInverseMethod()
 			 */
 			void calculateMassMatrixInverse(::rl::math::Matrix& invM);
 			
@@ -146,6 +172,32 @@ namespace rl
 			 */
 			void calculateOperationalMassMatrixInverse(const ::rl::math::Matrix& J, const ::rl::math::Matrix& invM, ::rl::math::Matrix& invMx) const;
 			
+			/**
+			 * Calculate operational space mass matrix inverse via articulated-body recursion.
+			 *
+			 * Applies unit forces at all operational frames and propagates the
+			 * resulting accelerations through the articulated-body inertias,
+			 * without forming the Jacobian or the joint space mass matrix inverse.
+			 *
+			 * @param[in] inWorldFrame Calculate in world or tool frame
+			 *
+			 * @pre setPosition()
+			 * @pre forwardPosition()
+			 * @post getOperationalMassMatrixInverse()
+			 */
+			void calculateOperationalMassMatrixInverse(const bool& inWorldFrame);
+			
+			/**
+			 * Calculate operational space mass matrix inverse via articulated-body recursion.
+			 *
+			 * @param[out] invMx Operational space mass matrix inverse \f$\matr{M}_{\mathrm{x}}^{-1}(\vec{q})\f$
+			 * @param[in] inWorldFrame Calculate in world or tool frame
+			 *
+			 * @pre setPosition()
+			 * @pre forwardPosition()
+			 */
+			void calculateOperationalMassMatrixInverse(::rl::math::Matrix& invMx, const bool& inWorldFrame);
+			
 			RL_MDL_DEPRECATED void eulerCauchy(const ::rl::math::Real& dt);
 			
 			/**
@@ -160,6 +212,20 @@ namespace rl
 			 */
 			void forwardDynamics();
 			
+			/**
+			 * Forward dynamics via articulated-body algorithm in workspace.
+			 *
+			 * Does not modify the model and can be called concurrently with
+			 * separate workspaces.
+			 *
+			 * @pre Data::qd
+			 * @pre Data::tau
+			 * @pre Data::fX
+			 * @pre forwardPosition(Data&) const
+			 * @post Data::qdd
+			 */
+			void forwardDynamics(Data& data) const;
+			
 			/**
 			 * Access calculated centrifugal and Coriolis vector.
 			 *
@@ -201,6 +267,10 @@ namespace rl
 			 */
 			const ::rl::math::Matrix& getMassMatrix() const;
 			
+			const MassMatrixInverseMethod& getMassMatrixInverseMethod() const;
+			
+			const MassMatrixMethod& getMassMatrixMethod() const;
+			
 			/**
 			 * Access calculated operational space mass matrix inverse.
 			 *
@@ -226,10 +296,50 @@ namespace rl
 			 */
 			void inverseDynamics();
 			
+			/**
+			 * Inverse dynamics via recursive Newton-Euler algorithm in workspace.
+			 *
+			 * Does not modify the model and can be called concurrently with
+			 * separate workspaces.
+			 *
+			 * @pre Data::qd
+			 * @pre Data::qdd
+			 * @pre Data::fX
+			 * @pre forwardPosition(Data&) const
+			 * @post Data::tau
+			 */
+			void inverseDynamics(Data& data) const;
+			
 			void inverseForce();
 			
 			RL_MDL_DEPRECATED void rungeKuttaNystrom(const ::rl::math::Real& dt);
 			
+			/**
+			 * Select algorithm used by calculateMassMatrixInverse().
+			 *
+			 * The articulated-body recursion is the default. It reuses the
+			 * articulated-body inertias of forwardDynamics() and propagates unit
+			 * torques for all columns in one backward and one forward pass.
+			 *
+			 * Justin Carpentier and Nicolas Mansard. Analytical Derivatives of
+			 * Rigid Body Dynamics Algorithms. In Proceedings of Robotics: Science
+			 * and Systems, 2018.
+			 */
+			void setMassMatrixInverseMethod(const MassMatrixInverseMethod& massMatrixInverseMethod);
+			
+			/**
+			 * Select algorithm used by calculateMassMatrix().
+			 *
+			 * The composite-rigid-body algorithm is the default. It computes the
+			 * composite inertia of each subtree in a single backward pass and
+			 * fills each column by propagating a single force vector towards the
+			 * root, avoiding a complete inverse dynamics pass per column.
+			 *
+			 * Roy Featherstone. Rigid Body Dynamics Algorithms. Springer, New
+			 * York, NY, USA, 2008. Chapter 6.2.
+			 */
+			void setMassMatrixMethod(const MassMatrixMethod& massMatrixMethod);
+			
 			virtual void update();
 			
 		protected:
@@ -289,7 +399,25 @@ namespace rl
 			::rl::math::Vector V;
 			
 		private:
+			/**
+			 * Propagate joint torques and external forces through articulated-body inertias.
+			 *
+			 * @param[in,out] Q Joint torques on input, joint accelerations on output (one column per case)
+			 * @param[in,out] P Bias forces per transform on input, spatial accelerations on output
+			 */
+			void calculateArticulatedBodyResponse(::rl::math::Matrix& Q, ::std::vector<::Eigen::Matrix<::rl::math::Real, 6, ::Eigen::Dynamic>>& P);
+			
+			void calculateMassMatrixCompositeRigidBody(::rl::math::Matrix& M);
+			
+			void calculateMassMatrixInverseArticulatedBody(::rl::math::Matrix& invM);
+			
+			void calculateMassMatrixInverseDynamics(::rl::math::Matrix& M);
+			
+			void calculateMassMatrixInverseForwardDynamics(::rl::math::Matrix& invM);
+			
+			MassMatrixInverseMethod massMatrixInverseMethod;
 			
+			MassMatrixMethod massMatrixMethod;
 		};
 	}
 }
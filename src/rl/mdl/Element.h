@@ -43,6 +43,10 @@ namespace rl
 			
 			virtual ~Element();
 			
+			virtual void compositeRigidBody1() = 0;
+			
+			virtual void compositeRigidBody2() = 0;
+			
 			virtual void forwardAcceleration() = 0;
 			
 			virtual void forwardDynamics1() = 0;
@@ -37,6 +37,7 @@ namespace rl
 			f(::rl::math::ForceVector::Zero()),
 			i(::rl::math::RigidBodyInertia::Identity()),
 			iA(::rl::math::ArticulatedBodyInertia::Identity()),
+			iC(::rl::math::RigidBodyInertia::Zero()),
 			pA(::rl::math::ForceVector::Zero()),
 			v(::rl::math::MotionVector::Zero()),
 			x(::rl::math::PlueckerTransform::Identity()),
@@ -48,6 +49,17 @@ namespace rl
 		{
 		}
 		
+		void
+		Frame::compositeRigidBody1()
+		{
+			this->iC.setZero();
+		}
+		
+		void
+		Frame::compositeRigidBody2()
+		{
+		}
+		
 		void
 		Frame::forwardAcceleration()
 		{
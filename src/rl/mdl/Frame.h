@@ -56,6 +56,10 @@ namespace rl
 			
 			virtual ~Frame();
 			
+			virtual void compositeRigidBody1();
+			
+			virtual void compositeRigidBody2();
+			
 			virtual void forwardAcceleration();
 			
 			virtual void forwardDynamics1();
@@ -88,6 +92,8 @@ namespace rl
 			
 			::rl::math::ArticulatedBodyInertia iA;
 			
+			::rl::math::RigidBodyInertia iC;
+			
 			::rl::math::ForceVector pA;
 			
 			::rl::math::MotionVector v;
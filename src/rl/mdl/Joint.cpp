@@ -335,6 +335,13 @@ namespace rl
 			this->offset = offset;
 		}
 		
+		void
+		Joint::setPosition(const ::rl::math::ConstVectorRef& q)
+		{
+			this->q = q;
+			this->calculateTransform(this->q, this->x);
+		}
+		
 		void
 		Joint::setSpeed(const ::rl::math::ConstVectorRef& speed)
 		{
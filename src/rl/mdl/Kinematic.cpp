@@ -32,6 +32,7 @@
 
 #include "Exception.h"
 #include "JacobianInverseKinematics.h"
+#include "Joint.h"
 #include "Kinematic.h"
 #include "Prismatic.h"
 #include "Revolute.h"
@@ -75,32 +76,84 @@ namespace rl
 			assert(J.rows() == this->getOperationalDof() * 6);
 			assert(J.cols() == this->getDof());
 			
-			::rl::math::Vector tmp(this->getDof());
+			J.setZero();
 			
-			for (::std::size_t i = 0; i < this->getDof(); ++i)
+			for (::std::size_t i = 0; i < this->getOperationalDof(); ++i)
 			{
-				for (::std::size_t j = 0; j < this->getDof(); ++j)
+				// operational frame relative to out frame of current transform
+				::rl::math::Transform x = ::rl::math::Transform::Identity();
+				
+				for (::std::size_t k = this->operationalParents[i]; k < this->transforms.size(); k = this->parents[k])
 				{
-					tmp(j) = i == j ? 1 : 0;
+					if (this->offsets[k] < this->getDof())
+					{
+						Joint* joint = static_cast<Joint*>(this->transforms[k]);
+						::rl::math::PlueckerTransform X(x);
+						
+						for (::std::ptrdiff_t j = 0; j < joint->S.cols(); ++j)
+						{
+							// X * S
+							::rl::math::MotionVector s = X * ::rl::math::MotionVector(joint->S.col(j));
+							J.block(i * 6, this->offsets[k] + j, 3, 1) = s.linear();
+							J.block(i * 6 + 3, this->offsets[k] + j, 3, 1) = s.angular();
+						}
+					}
+					
+					x = this->transforms[k]->x.transform() * x;
 				}
 				
-				this->setVelocity(tmp);
-				this->forwardVelocity();
+				if (inWorldFrame)
+				{
+					::rl::math::Matrix33 R = (this->world() * x).linear();
+					J.middleRows(i * 6, 3) = R * J.middleRows(i * 6, 3);
+					J.middleRows(i * 6 + 3, 3) = R * J.middleRows(i * 6 + 3, 3);
+				}
+			}
+			
+			J = J * this->gammaVelocity;
+		}
+		
+		void
+		Kinematic::calculateJacobian(Data& data, const bool& inWorldFrame) const
+		{
+			assert(data.J.rows() == this->getOperationalDof() * 6);
+			assert(data.J.cols() == this->getDof());
+			
+			data.J.setZero();
+			
+			for (::std::size_t i = 0; i < this->getOperationalDof(); ++i)
+			{
+				// operational frame relative to out frame of current transform
+				::rl::math::Transform x = ::rl::math::Transform::Identity();
 				
-				for (::std::size_t j = 0; j < this->getOperationalDof(); ++j)
+				for (::std::size_t k = this->operationalParents[i]; k < this->transforms.size(); k = this->parents[k])
 				{
-					if (inWorldFrame)
-					{
-						J.block(j * 6, i, 3, 1) = this->getOperationalPosition(j).linear() * this->getOperationalVelocity(j).linear();
-						J.block(j * 6 + 3, i, 3, 1) = this->getOperationalPosition(j).linear() * this->getOperationalVelocity(j).angular();
-					}
-					else
+					if (this->offsets[k] < this->getDof())
 					{
-						J.block(j * 6, i, 3, 1) = this->getOperationalVelocity(j).linear();
-						J.block(j * 6 + 3, i, 3, 1) = this->getOperationalVelocity(j).angular();
+						Joint* joint = static_cast<Joint*>(this->transforms[k]);
+						::rl::math::PlueckerTransform X(x);
+						
+						for (::std::ptrdiff_t j = 0; j < joint->S.cols(); ++j)
+						{
+							// X * S
+							::rl::math::MotionVector s = X * ::rl::math::MotionVector(joint->S.col(j));
+							data.J.block(i * 6, this->offsets[k] + j, 3, 1) = s.linear();
+							data.J.block(i * 6 + 3, this->offsets[k] + j, 3, 1) = s.angular();
+						}
 					}
+					
+					x = data.X[k].transform() * x;
+				}
+				
+				if (inWorldFrame)
+				{
+					::rl::math::Matrix33 R = (data.x[0].transform() * x).linear();
+					data.J.middleRows(i * 6, 3) = R * data.J.middleRows(i * 6, 3);
+					data.J.middleRows(i * 6 + 3, 3) = R * data.J.middleRows(i * 6 + 3, 3);
 				}
 			}
+			
+			data.J = data.J * this->gammaVelocity;
 		}
 		
 		void
@@ -190,6 +243,32 @@ namespace rl
 			}
 		}
 		
+		void
+		Kinematic::forwardAcceleration(Data& data) const
+		{
+			::rl::math::Vector qd = this->gammaVelocity * data.qd;
+			::rl::math::Vector qdd = this->gammaVelocity * data.qdd;
+			
+			data.a[0].setZero();
+			
+			for (::std::size_t i = 0; i < this->transforms.size(); ++i)
+			{
+				::std::size_t in = this->parents[i] < this->transforms.size() ? this->parents[i] + 1 : 0;
+				
+				// X * a
+				data.a[i + 1] = data.X[i] * data.a[in];
+				
+				if (this->offsets[i] < this->getDof())
+				{
+					Joint* joint = static_cast<Joint*>(this->transforms[i]);
+					// S * qd
+					::rl::math::MotionVector v(joint->S * qd.segment(this->offsets[i], joint->getDof()));
+					// X * a + S * qdd + v x vj
+					data.a[i + 1] += ::rl::math::MotionVector(joint->S * qdd.segment(this->offsets[i], joint->getDof())) + data.v[i + 1].cross(v);
+				}
+			}
+		}
+		
 		void
 		Kinematic::forwardPosition()
 		{
@@ -199,6 +278,156 @@ namespace rl
 			}
 		}
 		
+		void
+		Kinematic::forwardPosition(Data& data) const
+		{
+			::rl::math::Vector q = this->gammaPosition * data.q;
+			
+			data.x[0] = this->tree[this->root]->x;
+			
+			for (::std::size_t i = 0, j = 0; i < this->transforms.size(); ++i)
+			{
+				::std::size_t in = this->parents[i] < this->transforms.size() ? this->parents[i] + 1 : 0;
+				
+				if (this->offsets[i] < this->getDof())
+				{
+					Joint* joint = static_cast<Joint*>(this->transforms[i]);
+					joint->calculateTransform(q.segment(j, joint->getDofPosition()), data.X[i]);
+					j += joint->getDofPosition();
+				}
+				else
+				{
+					data.X[i] = this->transforms[i]->x;
+				}
+				
+				data.x[i + 1] = data.x[in] * data.X[i];
+			}
+		}
+		
+		void
+		Kinematic::forwardPosition(const ::rl::math::ConstMatrixRef& q, ::rl::math::Matrix& operational) const
+		{
+			::rl::math::Matrix bodies;
+			this->forwardPosition(q, operational, bodies);
+		}
+		
+		void
+		Kinematic::forwardPosition(const ::rl::math::ConstMatrixRef& q, ::rl::math::Matrix& operational, ::rl::math::Matrix& bodies) const
+		{
+			assert(q.rows() == this->getDofPosition());
+			
+			operational.resize(q.cols(), 12 * this->getOperationalDof());
+			bodies.resize(q.cols(), 12 * this->getBodies());
+			
+			// configurations per block, keeps all frames of a block in cache
+			::std::ptrdiff_t size = ::std::min<::std::ptrdiff_t>(q.cols(), 64);
+			
+			::rl::math::Matrix y(this->getDofPosition(), size);
+			// frames, 12 columns each
+			::rl::math::Matrix x(size, 12 * this->getFrames());
+			// current transform, 12 columns
+			::rl::math::Matrix X(size, 12);
+			::rl::math::Vector c(size);
+			::rl::math::Vector s(size);
+			::rl::math::PlueckerTransform t;
+			
+			for (::std::ptrdiff_t begin = 0; begin < q.cols(); begin += size)
+			{
+				::std::ptrdiff_t m = ::std::min(size, q.cols() - begin);
+				
+				y.leftCols(m).noalias() = this->gammaPosition * q.middleCols(begin, m);
+				
+				for (::std::ptrdiff_t j = 0; j < 4; ++j)
+				{
+					for (::std::ptrdiff_t k = 0; k < 3; ++k)
+					{
+						x.col(3 * j + k).head(m).setConstant(this->world().matrix()(k, j));
+					}
+				}
+				
+				for (::std::size_t i = 0, l = 0; i < this->transforms.size(); ++i)
+				{
+					::std::size_t in = this->parents[i] < this->transforms.size() ? this->parents[i] + 1 : 0;
+					
+					if (Revolute* revolute = dynamic_cast<Revolute*>(this->transforms[i]))
+					{
+						::rl::math::Vector3 axis = revolute->S.block<3, 1>(0, 0);
+						::rl::math::Matrix33 cross = axis.cross33();
+						::rl::math::Matrix33 outer = axis * axis.transpose();
+						c.head(m) = (y.row(l).head(m).transpose().array() + revolute->offset(0)).cos();
+						s.head(m) = (y.row(l).head(m).transpose().array() + revolute->offset(0)).sin();
+						
+						for (::std::ptrdiff_t j = 0; j < 3; ++j)
+						{
+							for (::std::ptrdiff_t k = 0; k < 3; ++k)
+							{
+								// cos * 1 + sin * a x + (1 - cos) * a * a^T
+								X.col(3 * j + k).head(m) = c.head(m).array() * ((j == k ? 1 : 0) - outer(k, j)) + s.head(m).array() * cross(k, j) + outer(k, j);
+							}
+						}
+						
+						X.rightCols<3>().topRows(m).setZero();
+						
+						l += revolute->getDofPosition();
+					}
+					else if (this->offsets[i] < this->getDof())
+					{
+						Joint* joint = static_cast<Joint*>(this->transforms[i]);
+						
+						for (::std::ptrdiff_t n = 0; n < m; ++n)
+						{
+							joint->calculateTransform(y.col(n).segment(l, joint->getDofPosition()), t);
+							
+							for (::std::ptrdiff_t j = 0; j < 4; ++j)
+							{
+								for (::std::ptrdiff_t k = 0; k < 3; ++k)
+								{
+									X(n, 3 * j + k) = t.transform().matrix()(k, j);
+								}
+							}
+						}
+						
+						l += joint->getDofPosition();
+					}
+					else
+					{
+						for (::std::ptrdiff_t j = 0; j < 4; ++j)
+						{
+							for (::std::ptrdiff_t k = 0; k < 3; ++k)
+							{
+								X.col(3 * j + k).head(m).setConstant(this->transforms[i]->x.transform().matrix()(k, j));
+							}
+						}
+					}
+					
+					// x_in * X
+					for (::std::ptrdiff_t j = 0; j < 4; ++j)
+					{
+						for (::std::ptrdiff_t k = 0; k < 3; ++k)
+						{
+							x.col(12 * (i + 1) + 3 * j + k).head(m) =
+								x.col(12 * in + k).head(m).cwiseProduct(X.col(3 * j).head(m)) +
+								x.col(12 * in + 3 + k).head(m).cwiseProduct(X.col(3 * j + 1).head(m)) +
+								x.col(12 * in + 6 + k).head(m).cwiseProduct(X.col(3 * j + 2).head(m));
+						}
+					}
+					
+					x.block(0, 12 * (i + 1) + 9, m, 3) += x.block(0, 12 * in + 9, m, 3);
+				}
+				
+				for (::std::size_t i = 0; i < this->getOperationalDof(); ++i)
+				{
+					::std::size_t k = this->operationalParents[i] < this->transforms.size() ? this->operationalParents[i] + 1 : 0;
+					operational.block(begin, 12 * i, m, 12) = x.block(0, 12 * k, m, 12);
+				}
+				
+				for (::std::size_t i = 0; i < this->getBodies(); ++i)
+				{
+					bodies.block(begin, 12 * i, m, 12) = x.block(0, 12 * this->bodyFrames[i], m, 12);
+				}
+			}
+		}
+		
 		void
 		Kinematic::forwardVelocity()
 		{
@@ -208,6 +437,29 @@ namespace rl
 			}
 		}
 		
+		void
+		Kinematic::forwardVelocity(Data& data) const
+		{
+			::rl::math::Vector qd = this->gammaVelocity * data.qd;
+			
+			data.v[0].setZero();
+			
+			for (::std::size_t i = 0; i < this->transforms.size(); ++i)
+			{
+				::std::size_t in = this->parents[i] < this->transforms.size() ? this->parents[i] + 1 : 0;
+				
+				// X * v
+				data.v[i + 1] = data.X[i] * data.v[in];
+				
+				if (this->offsets[i] < this->getDof())
+				{
+					Joint* joint = static_cast<Joint*>(this->transforms[i]);
+					// X * v + S * qd
+					data.v[i + 1] += ::rl::math::MotionVector(joint->S * qd.segment(this->offsets[i], joint->getDof()));
+				}
+			}
+		}
+		
 		const ::rl::math::Matrix&
 		Kinematic::getJacobian() const
 		{
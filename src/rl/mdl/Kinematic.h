@@ -29,6 +29,7 @@
 
 #include <rl/math/Matrix.h>
 
+#include "Data.h"
 #include "Metric.h"
 
 namespace rl
@@ -55,12 +56,14 @@ namespace rl
 			/**
 			 * Calculate Jacobian matrix.
 			 *
+			 * Columns are obtained in a single sweep from each operational frame
+			 * towards the root by transforming the motion subspace of every
+			 * joint on the way into the operational frame.
+			 *
 			 * @param[in] inWorldFrame Calculate in world or tool frame
 			 *
 			 * @pre setPosition()
 			 * @post getJacobian()
-			 *
-			 * @see forwardVelocity()
 			 */
 			void calculateJacobian(const bool& inWorldFrame = true);
 			
@@ -71,11 +74,19 @@ namespace rl
 			 * @param[in] inWorldFrame Calculate in world or tool frame
 			 *
 			 * @pre setPosition()
-			 *
-			 * @see forwardVelocity()
 			 */
 			void calculateJacobian(::rl::math::Matrix& J, const bool& inWorldFrame = true);
 			
+			/**
+			 * Calculate Jacobian matrix in workspace.
+			 *
+			 * @param[in,out] data Workspace, result in Data::J
+			 * @param[in] inWorldFrame Calculate in world or tool frame
+			 *
+			 * @pre forwardPosition(Data&) const
+			 */
+			void calculateJacobian(Data& data, const bool& inWorldFrame = true) const;
+			
 			/**
 			 * Calculate Jacobian derivative vector.
 			 *
@@ -166,12 +177,53 @@ namespace rl
 			 */
 			void forwardAcceleration();
 			
+			/**
+			 * @pre Data::qd
+			 * @pre Data::qdd
+			 * @pre forwardVelocity(Data&) const
+			 * @post getOperationalAcceleration(const Data&, const ::std::size_t&) const
+			 */
+			void forwardAcceleration(Data& data) const;
+			
 			/**
 			 * @pre setPosition()
 			 * @post getOperationalPosition()
 			 */
 			void forwardPosition();
 			
+			/**
+			 * Calculate frame poses in workspace without modifying the model.
+			 *
+			 * @pre Data::q
+			 * @post getOperationalPosition(const Data&, const ::std::size_t&) const
+			 */
+			void forwardPosition(Data& data) const;
+			
+			/**
+			 * Calculate operational frames for a batch of configurations.
+			 *
+			 * @param[in] q Generalized positions, one column per configuration
+			 * @param[out] operational Operational frames in the layout of
+			 * forwardPosition(const ::rl::math::ConstMatrixRef&, ::rl::math::Matrix&, ::rl::math::Matrix&) const
+			 */
+			void forwardPosition(const ::rl::math::ConstMatrixRef& q, ::rl::math::Matrix& operational) const;
+			
+			/**
+			 * Calculate operational and body frames for a batch of configurations.
+			 *
+			 * Frames are stored in structure-of-arrays layout with one row per
+			 * configuration and twelve columns per frame, so all configurations
+			 * are processed with vectorized column operations. Column
+			 * \f$12 i + 3 j + k\f$ contains entry \f$(k, j)\f$ of the upper
+			 * \f$3 \times 4\f$ part of the transformation matrix of frame \f$i\f$,
+			 * i.e., the rotation in column-major order followed by the translation.
+			 *
+			 * @param[in] q Generalized positions, one column per configuration
+			 * @param[out] operational Operational frames
+			 * @param[out] bodies Body frames
+			 */
+			void forwardPosition(const ::rl::math::ConstMatrixRef& q, ::rl::math::Matrix& operational, ::rl::math::Matrix& bodies) const;
+			
 			/**
 			 * @pre setPosition()
 			 * @pre setVelocity()
@@ -179,6 +231,13 @@ namespace rl
 			 */
 			void forwardVelocity();
 			
+			/**
+			 * @pre Data::qd
+			 * @pre forwardPosition(Data&) const
+			 * @post getOperationalVelocity(const Data&, const ::std::size_t&) const
+			 */
+			void forwardVelocity(Data& data) const;
+			
 			/**
 			 * Access calculated Jacobian matrix.
 			 *
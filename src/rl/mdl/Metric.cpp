@@ -26,6 +26,7 @@
 
 #include "Joint.h"
 #include "Metric.h"
+#include "Revolute.h"
 
 namespace rl
 {
@@ -52,7 +53,7 @@ namespace rl
 		}
 		
 		::rl::math::Real
-		Metric::distance(const ::rl::math::Vector& q1, const ::rl::math::Vector& q2) const
+		Metric::distance(const ::rl::math::ConstVectorRef& q1, const ::rl::math::ConstVectorRef& q2) const
 		{
 			assert(q1.size() == this->getDofPosition());
 			assert(q2.size() == this->getDofPosition());
@@ -147,7 +148,7 @@ namespace rl
 		}
 		
 		::rl::math::Real
-		Metric::transformedDistance(const ::rl::math::Vector& q1, const ::rl::math::Vector& q2) const
+		Metric::transformedDistance(const ::rl::math::ConstVectorRef& q1, const ::rl::math::ConstVectorRef& q2) const
 		{
 			assert(q1.size() == this->getDofPosition());
 			assert(q2.size() == this->getDofPosition());
@@ -181,6 +182,46 @@ namespace rl
 			}
 		}
 		
+		void
+		Metric::transformedDistance(const ::rl::math::Vector& q1, const ::rl::math::Matrix& q2, ::rl::math::Vector& d) const
+		{
+			assert(q1.size() == this->getDofPosition());
+			assert(q2.rows() == this->getDofPosition());
+			
+			d.resize(q2.cols());
+			
+			if (this->getDof() != this->getDofPosition())
+			{
+				for (::std::ptrdiff_t i = 0; i < q2.cols(); ++i)
+				{
+					d(i) = 0;
+					
+					for (::std::size_t j = 0, k = 0; j < this->joints.size(); k += this->joints[j]->getDofPosition(), ++j)
+					{
+						d(i) += this->joints[j]->transformedDistance(
+							q1.segment(k, this->joints[j]->getDofPosition()),
+							q2.col(i).segment(k, this->joints[j]->getDofPosition())
+						);
+					}
+				}
+				
+				return;
+			}
+			
+			::rl::math::Matrix delta = (q2.colwise() - q1).cwiseAbs();
+			
+			for (::std::size_t i = 0, j = 0; i < this->joints.size(); j += this->joints[i]->getDofPosition(), ++i)
+			{
+				if (nullptr != dynamic_cast<Revolute*>(this->joints[i]) && this->joints[i]->wraparound(0))
+				{
+					::rl::math::Real range = ::std::abs(this->joints[i]->max(0) - this->joints[i]->min(0));
+					delta.row(j) = delta.row(j).cwiseMin((range - delta.row(j).array()).abs().matrix());
+				}
+			}
+			
+			d = delta.colwise().squaredNorm().transpose();
+		}
+		
 		void
 		Metric::update()
 		{
@@ -44,7 +44,7 @@ namespace rl
 			
 			Model* clone() const;
 			
-			::rl::math::Real distance(const ::rl::math::Vector& q1, const ::rl::math::Vector& q2) const;
+			::rl::math::Real distance(const ::rl::math::ConstVectorRef& q1, const ::rl::math::ConstVectorRef& q2) const;
 			
 			void interpolate(const ::rl::math::Vector& q1, const ::rl::math::Vector& q2, const ::rl::math::Real& alpha, ::rl::math::Vector& q) const;
 			
@@ -58,10 +58,23 @@ namespace rl
 			
 			::rl::math::Real transformedDistance(const ::rl::math::Real& d) const;
 			
-			::rl::math::Real transformedDistance(const ::rl::math::Vector& q1, const ::rl::math::Vector& q2) const;
+			::rl::math::Real transformedDistance(const ::rl::math::ConstVectorRef& q1, const ::rl::math::ConstVectorRef& q2) const;
 			
 			::rl::math::Real transformedDistance(const ::rl::math::Real& q1, const ::rl::math::Real& q2, const ::std::size_t& i) const;
 			
+			/**
+			 * Transformed distances of one configuration to a batch of configurations.
+			 * 
+			 * Evaluates all columns at once with vectorized Eigen expressions
+			 * if every joint has a separable metric (i.e., no spherical or
+			 * six-DOF joints) and falls back to one call per column otherwise.
+			 * 
+			 * @param[in] q1 Configuration
+			 * @param[in] q2 Configurations, one per column
+			 * @param[out] d Transformed distance to each column of q2
+			 */
+			void transformedDistance(const ::rl::math::Vector& q1, const ::rl::math::Matrix& q2, ::rl::math::Vector& d) const;
+			
 			virtual void update();
 			
 		protected:
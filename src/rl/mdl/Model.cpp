@@ -25,6 +25,7 @@
 //
 
 #include "Body.h"
+#include "Data.h"
 #include "Exception.h"
 #include "Joint.h"
 #include "Model.h"
@@ -36,6 +37,7 @@ namespace rl
 	{
 		Model::Model() :
 			bodies(),
+			bodyFrames(),
 			dof(),
 			dofPosition(),
 			elements(),
@@ -49,6 +51,9 @@ namespace rl
 			leaves(),
 			manufacturer(),
 			name(),
+			offsets(),
+			operationalParents(),
+			parents(),
 			root(0),
 			tools(),
 			transforms(),
@@ -321,6 +326,14 @@ namespace rl
 			return this->tree[this->leaves[i]]->a;
 		}
 		
+		const ::rl::math::MotionVector&
+		Model::getOperationalAcceleration(const Data& data, const ::std::size_t& i) const
+		{
+			assert(i < this->getOperationalDof());
+			
+			return data.a[this->operationalParents[i] < this->transforms.size() ? this->operationalParents[i] + 1 : 0];
+		}
+		
 		::std::size_t
 		Model::getOperationalDof() const
 		{
@@ -351,6 +364,14 @@ namespace rl
 			return this->tree[this->leaves[i]]->x.transform();
 		}
 		
+		const ::rl::math::Transform&
+		Model::getOperationalPosition(const Data& data, const ::std::size_t& i) const
+		{
+			assert(i < this->getOperationalDof());
+			
+			return data.x[this->operationalParents[i] < this->transforms.size() ? this->operationalParents[i] + 1 : 0].transform();
+		}
+		
 		const ::rl::math::MotionVector&
 		Model::getOperationalVelocity(const ::std::size_t& i) const
 		{
@@ -359,6 +380,14 @@ namespace rl
 			return this->tree[this->leaves[i]]->v;
 		}
 		
+		const ::rl::math::MotionVector&
+		Model::getOperationalVelocity(const Data& data, const ::std::size_t& i) const
+		{
+			assert(i < this->getOperationalDof());
+			
+			return data.v[this->operationalParents[i] < this->transforms.size() ? this->operationalParents[i] + 1 : 0];
+		}
+		
 		const ::std::string&
 		Model::getManufacturer() const
 		{
@@ -728,11 +757,16 @@ namespace rl
 		Model::update()
 		{
 			this->bodies.clear();
+			this->bodyFrames.clear();
 			this->dof = 0;
 			this->dofPosition = 0;
 			this->elements.clear();
+			this->frames.clear();
 			this->joints.clear();
 			this->leaves.clear();
+			this->offsets.clear();
+			this->operationalParents.clear();
+			this->parents.clear();
 			this->tools.clear();
 			this->transforms.clear();
 			
@@ -744,6 +778,44 @@ namespace rl
 				this->dofPosition += this->joints[i]->getDofPosition();
 			}
 			
+			for (::std::size_t i = 0, j = 0; i < this->transforms.size(); ++i)
+			{
+				if (Joint* joint = dynamic_cast<Joint*>(this->transforms[i]))
+				{
+					this->offsets.push_back(j);
+					j += joint->getDof();
+				}
+				else
+				{
+					this->offsets.push_back(this->getDof());
+				}
+				
+				this->parents.push_back(this->transforms.size());
+				
+				for (::std::size_t k = i; k > 0; --k)
+				{
+					if (this->transforms[k - 1]->out == this->transforms[i]->in)
+					{
+						this->parents.back() = k - 1;
+						break;
+					}
+				}
+			}
+			
+			for (::std::size_t i = 0; i < this->leaves.size(); ++i)
+			{
+				this->operationalParents.push_back(this->transforms.size());
+				
+				for (::std::size_t k = 0; k < this->transforms.size(); ++k)
+				{
+					if (this->transforms[k]->out == this->tree[this->leaves[i]].get())
+					{
+						this->operationalParents.back() = k;
+						break;
+					}
+				}
+			}
+			
 			this->gammaPosition = ::rl::math::Matrix::Identity(this->getDofPosition(), this->getDofPosition());
 			this->gammaVelocity = ::rl::math::Matrix::Identity(this->getDof(), this->getDof());
 			this->home = ::rl::math::Vector::Zero(this->getDofPosition());
@@ -761,6 +833,7 @@ namespace rl
 			if (Body* body = dynamic_cast<Body*>(frame))
 			{
 				this->bodies.push_back(body);
+				this->bodyFrames.push_back(this->frames.size() - 1);
 			}
 			
 			if (::boost::out_degree(u, this->tree) > 0)
@@ -50,6 +50,7 @@ namespace rl
 	namespace mdl
 	{
 		class Body;
+		class Data;
 		class Joint;
 		class World;
 		
@@ -116,6 +117,8 @@ namespace rl
 			
 			const ::rl::math::MotionVector& getOperationalAcceleration(const ::std::size_t& i) const;
 			
+			const ::rl::math::MotionVector& getOperationalAcceleration(const Data& data, const ::std::size_t& i) const;
+			
 			::std::size_t getOperationalDof() const;
 			
 			const ::rl::math::ForceVector& getOperationalForce(const ::std::size_t& i) const;
@@ -124,8 +127,12 @@ namespace rl
 			
 			const ::rl::math::Transform& getOperationalPosition(const ::std::size_t& i) const;
 			
+			const ::rl::math::Transform& getOperationalPosition(const Data& data, const ::std::size_t& i) const;
+			
 			const ::rl::math::MotionVector& getOperationalVelocity(const ::std::size_t& i) const;
 			
+			const ::rl::math::MotionVector& getOperationalVelocity(const Data& data, const ::std::size_t& i) const;
+			
 			const ::std::string& getManufacturer() const;
 			
 			::rl::math::Vector getMaximum() const;
@@ -241,6 +248,11 @@ namespace rl
 			
 			::std::vector<Body*> bodies;
 			
+			/**
+			 * Index of frame for each body.
+			 */
+			::std::vector<::std::size_t> bodyFrames;
+			
 			::std::size_t dof;
 			
 			::std::size_t dofPosition;
@@ -267,6 +279,27 @@ namespace rl
 			
 			::std::string name;
 			
+			/**
+			 * Velocity offset of each transform in joint space.
+			 *
+			 * Equal to getDof() for transforms that are not joints.
+			 */
+			::std::vector<::std::size_t> offsets;
+			
+			/**
+			 * Index of the transform leading to each operational frame.
+			 *
+			 * Equal to getTransforms() for operational frames at the root.
+			 */
+			::std::vector<::std::size_t> operationalParents;
+			
+			/**
+			 * Index of the transform leading to the parent frame of each transform.
+			 *
+			 * Equal to getTransforms() for transforms starting at the root.
+			 */
+			::std::vector<::std::size_t> parents;
+			
 			Vertex root;
 			
 			::std::vector<Edge> tools;
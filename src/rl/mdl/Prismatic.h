@@ -40,7 +40,7 @@ namespace rl
 			
 			virtual ~Prismatic();
 			
-			void setPosition(const ::rl::math::ConstVectorRef& q);
+			void calculateTransform(const ::rl::math::ConstVectorRef& q, ::rl::math::PlueckerTransform& x) const;
 			
 		protected:
 			
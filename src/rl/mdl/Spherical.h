@@ -40,6 +40,8 @@ namespace rl
 			
 			virtual ~Spherical();
 			
+			void calculateTransform(const ::rl::math::ConstVectorRef& q, ::rl::math::PlueckerTransform& x) const;
+			
 			void clamp(::rl::math::VectorRef q) const;
 			
 			::rl::math::Real distance(const ::rl::math::ConstVectorRef& q1, const ::rl::math::ConstVectorRef& q2) const;
@@ -56,8 +58,6 @@ namespace rl
 			
 			void normalize(::rl::math::VectorRef q) const;
 			
-			void setPosition(const ::rl::math::ConstVectorRef& q);
-			
 			void step(const ::rl::math::ConstVectorRef& q1, const ::rl::math::ConstVectorRef& dq, ::rl::math::VectorRef q2) const;
 			
 			::rl::math::Real transformedDistance(const ::rl::math::ConstVectorRef& q1, const ::rl::math::ConstVectorRef& q2) const;
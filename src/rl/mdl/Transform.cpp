@@ -44,6 +44,18 @@ namespace rl
 		{
 		}
 		
+		void
+		Transform::compositeRigidBody1()
+		{
+		}
+		
+		void
+		Transform::compositeRigidBody2()
+		{
+			// I^c + X^* * I^c * X
+			this->in->iC = this->in->iC + this->x / this->out->iC;
+		}
+		
 		void
 		Transform::forwardAcceleration()
 		{
@@ -57,6 +57,10 @@ namespace rl
 			
 			virtual ~Transform();
 			
+			virtual void compositeRigidBody1();
+			
+			virtual void compositeRigidBody2();
+			
 			virtual void forwardAcceleration();
 			
 			virtual void forwardDynamics1();
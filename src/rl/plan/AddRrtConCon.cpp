@@ -36,7 +36,8 @@ namespace rl
 			RrtConCon(),
 			alpha(static_cast<::rl::math::Real>(0.05)),
 			lower(2),
-			radius(20)
+			radius(20),
+			vertices()
 		{
 		}
 		
@@ -45,21 +46,17 @@ namespace rl
 		}
 		
 		Rrt::Vertex
-		AddRrtConCon::addVertex(Tree& tree, const VectorPtr& q)
+		AddRrtConCon::addVertex(Tree& tree, const ::rl::math::Vector& q)
 		{
-			::std::shared_ptr<VertexBundle> bundle = ::std::make_shared<VertexBundle>();
-			bundle->index = ::boost::num_vertices(tree) - 1;
-			bundle->q = q;
-			bundle->radius = ::std::numeric_limits<::rl::math::Real>::max();
+			this->vertices.push_back(VertexBundle());
+			this->vertices.back().radius = ::std::numeric_limits<::rl::math::Real>::max();
+			Vertex v = insertVertex(tree, q, &this->vertices.back());
 			
-			Vertex v = ::boost::add_vertex(tree);
-			tree[v] = bundle;
-			
-			tree[::boost::graph_bundle].nn->push(Metric::Value(q.get(), v));
+			tree[::boost::graph_bundle].nn->push(Metric::Value(&tree[::boost::graph_bundle].configurations, get(tree, v)->index, v));
 			
 			if (nullptr != this->getViewer())
 			{
-				this->getViewer()->drawConfigurationVertex(*get(tree, v)->q);
+				this->getViewer()->drawConfigurationVertex(q);
 			}
 			
 			return v;
@@ -68,7 +65,7 @@ namespace rl
 		AddRrtConCon::VertexBundle*
 		AddRrtConCon::get(const Tree& tree, const Vertex& v)
 		{
-			return static_cast<VertexBundle*>(tree[v].get());
+			return static_cast<VertexBundle*>(tree[v]);
 		}
 		
 		::rl::math::Real
@@ -95,6 +92,13 @@ namespace rl
 			return this->radius;
 		}
 		
+		void
+		AddRrtConCon::reset()
+		{
+			RrtConCon::reset();
+			this->vertices.clear();
+		}
+		
 		void
 		AddRrtConCon::setAlpha(const ::rl::math::Real& alpha)
 		{
@@ -118,15 +122,15 @@ namespace rl
 		{
 			this->time = ::std::chrono::steady_clock::now();
 			
-			this->begin[0] = this->addVertex(this->tree[0], ::std::make_shared<::rl::math::Vector>(*this->getStart()));
-			this->begin[1] = this->addVertex(this->tree[1], ::std::make_shared<::rl::math::Vector>(*this->getGoal()));
+			this->begin[0] = this->addVertex(this->tree[0], *this->getStart());
+			this->begin[1] = this->addVertex(this->tree[1], *this->getGoal());
 			
 			Tree* a = &this->tree[0];
 			Tree* b = &this->tree[1];
 			
 			::rl::math::Vector chosen(this->getModel()->getDofPosition());
 			
-			while ((::std::chrono::steady_clock::now() - this->time) < this->getDuration())
+			while (!this->isCanceled() && (::std::chrono::steady_clock::now() - this->time) < this->getDuration())
 			{
 				for (::std::size_t j = 0; j < 2; ++j)
 				{
@@ -149,11 +153,12 @@ namespace rl
 						}
 						
 						Neighbor bNearest = this->nearest(*b, chosen);
-						Vertex bConnected = this->connect(*b, bNearest, *get(*a, aConnected)->q);
+						chosen = configuration(*a, aConnected);
+						Vertex bConnected = this->connect(*b, bNearest, chosen);
 						
 						if (nullptr != bConnected)
 						{
-							if (this->areEqual(*get(*a, aConnected)->q, *get(*b, bConnected)->q))
+							if (this->areEqual(configuration(*a, aConnected), configuration(*b, bConnected)))
 							{
 								this->end[0] = &this->tree[0] == a ? aConnected : bConnected;
 								this->end[1] = &this->tree[1] == b ? bConnected : aConnected;
@@ -27,6 +27,8 @@
 #ifndef RL_PLAN_ADDRRTCONCON_H
 #define RL_PLAN_ADDRRTCONCON_H
 
+#include <deque>
+
 #include "RrtConCon.h"
 
 namespace rl
@@ -58,6 +60,8 @@ namespace rl
 			
 			::rl::math::Real getRadius() const;
 			
+			void reset();
+			
 			void setAlpha(const ::rl::math::Real& alpha);
 			
 			void setLower(const ::rl::math::Real& lower);
@@ -81,12 +85,12 @@ namespace rl
 				::rl::math::Real radius;
 			};
 			
-			Vertex addVertex(Tree& tree, const VectorPtr& q);
+			Vertex addVertex(Tree& tree, const ::rl::math::Vector& q);
 			
 			static VertexBundle* get(const Tree& tree, const Vertex& v);
 			
 		private:
-			
+			::std::deque<VertexBundle> vertices;
 		};
 	}
 }
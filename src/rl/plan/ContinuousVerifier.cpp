@@ -0,0 +1,272 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <rl/math/Constants.h>
+#include <rl/mdl/Body.h>
+#include <rl/mdl/Joint.h>
+#include <rl/mdl/Kinematic.h>
+#include <rl/mdl/Prismatic.h>
+#include <rl/mdl/Revolute.h>
+#include <rl/sg/Body.h>
+
+#include "ContinuousVerifier.h"
+#include "DistanceModel.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		ContinuousVerifier::ContinuousVerifier() :
+			Verifier(),
+			bounds()
+		{
+		}
+		
+		ContinuousVerifier::~ContinuousVerifier()
+		{
+		}
+		
+		void
+		ContinuousVerifier::distances(::rl::math::Vector& d)
+		{
+			DistanceModel* model = static_cast<DistanceModel*>(this->getModel());
+			
+			d.resize(model->getBodies());
+			
+			::rl::math::Vector3 point1;
+			::rl::math::Vector3 point2;
+			
+			for (::std::size_t i = 0; i < model->getBodies(); ++i)
+			{
+				d(i) = model->distance(i, point1, point2);
+			}
+		}
+		
+		bool
+		ContinuousVerifier::isColliding(const ::rl::math::Vector& u, const ::rl::math::Vector& v, const ::rl::math::Real& d)
+		{
+			assert(u.size() == this->getModel()->getDofPosition());
+			assert(v.size() == this->getModel()->getDofPosition());
+			assert(nullptr != dynamic_cast<DistanceModel*>(this->getModel()));
+			
+			::std::queue<Segment> queue;
+			
+			Segment segment;
+			segment.a = 0;
+			segment.b = 1;
+			
+			this->getModel()->setPosition(v);
+			this->getModel()->updateFrames();
+			this->distances(segment.db);
+			
+			this->getModel()->setPosition(u);
+			this->getModel()->updateFrames();
+			this->distances(segment.da);
+			this->updateBounds();
+			
+			queue.push(segment);
+			
+			::rl::math::Vector qa(u.size());
+			::rl::math::Vector qb(u.size());
+			::rl::math::Vector inter(u.size());
+			
+			while (!queue.empty())
+			{
+				this->getModel()->interpolate(u, v, queue.front().a, qa);
+				this->getModel()->interpolate(u, v, queue.front().b, qb);
+				
+				::rl::math::Vector motion = this->motion(qa, qb);
+				
+				// every body stays within its displacement bound of either end
+				
+				if ((2 * motion.array() < queue.front().da.array()).all() || (2 * motion.array() < queue.front().db.array()).all())
+				{
+					queue.pop();
+					continue;
+				}
+				
+				if (this->getModel()->distance(qa, qb) <= this->delta)
+				{
+					queue.pop();
+					continue;
+				}
+				
+				segment.a = (queue.front().a + queue.front().b) / 2;
+				segment.b = queue.front().b;
+				
+				this->getModel()->interpolate(u, v, segment.a, inter);
+				
+				if (this->getModel()->isColliding(inter))
+				{
+					return true;
+				}
+				
+				this->distances(segment.da);
+				segment.db = queue.front().db;
+				queue.push(segment);
+				
+				segment.b = segment.a;
+				segment.a = queue.front().a;
+				segment.db = segment.da;
+				segment.da = queue.front().da;
+				queue.push(segment);
+				
+				queue.pop();
+			}
+			
+			return false;
+		}
+		
+		::rl::math::Vector
+		ContinuousVerifier::motion(const ::rl::math::Vector& q1, const ::rl::math::Vector& q2) const
+		{
+			::rl::math::Vector delta = (q2 - q1).cwiseAbs();
+			::Eigen::Matrix<bool, ::Eigen::Dynamic, 1> wraparounds = this->getModel()->getWraparounds();
+			
+			for (::std::ptrdiff_t i = 0; i < delta.size(); ++i)
+			{
+				if (wraparounds(i) && delta(i) > ::rl::math::constants::pi)
+				{
+					delta(i) = 2 * ::rl::math::constants::pi - delta(i);
+				}
+			}
+			
+			if (nullptr != this->getModel()->mdl)
+			{
+				delta = this->getModel()->mdl->getGammaPosition().cwiseAbs() * delta;
+			}
+			
+			::rl::math::Vector motion(this->bounds.cols());
+			
+			for (::std::ptrdiff_t i = 0; i < this->bounds.cols(); ++i)
+			{
+				motion(i) = 0;
+				
+				for (::std::ptrdiff_t j = 0; j < this->bounds.rows(); ++j)
+				{
+					if (delta(j) > 0)
+					{
+						motion(i) += this->bounds(j, i) * delta(j);
+					}
+				}
+			}
+			
+			return motion;
+		}
+		
+		void
+		ContinuousVerifier::updateBounds()
+		{
+			::rl::mdl::Kinematic* kinematic = this->getModel()->mdl;
+			
+			this->bounds.resize(nullptr != kinematic ? kinematic->getDofPosition() : this->getModel()->getDofPosition(), this->getModel()->getBodies());
+			this->bounds.setConstant(::std::numeric_limits<::rl::math::Real>::max());
+			
+			if (nullptr == kinematic)
+			{
+				return;
+			}
+			
+			::std::vector<::std::size_t> offsets(kinematic->getJoints());
+			
+			for (::std::size_t i = 0, offset = 0; i < kinematic->getJoints(); ++i)
+			{
+				offsets[i] = offset;
+				offset += kinematic->getJoint(i)->getDofPosition();
+			}
+			
+			for (::std::size_t i = 0; i < this->getModel()->getBodies(); ++i)
+			{
+				::rl::sg::Body* body = this->getModel()->getBody(i);
+				
+				if (body->max.isZero() && body->min.isZero())
+				{
+					continue;
+				}
+				
+				this->bounds.col(i).setZero();
+				
+				// bounding sphere of body
+				
+				::rl::math::Vector3 point = kinematic->getBodyFrame(i) * (0.5 * (body->max + body->min));
+				::rl::math::Real length = 0.5 * (body->max - body->min).norm();
+				
+				const ::rl::mdl::Frame* frame = kinematic->getBody(i);
+				::std::size_t j = 0;
+				
+				while (j < kinematic->getTransforms())
+				{
+					::rl::mdl::Transform* transform = kinematic->getTransform(j);
+					
+					if (frame != transform->out)
+					{
+						++j;
+						continue;
+					}
+					
+					// distance between bounding sphere and joint axis along the chain
+					
+					::rl::math::Vector3 origin = transform->out->x.transform().translation();
+					length = ::std::min(length + (point - origin).norm(), ::std::numeric_limits<::rl::math::Real>::max());
+					point = origin;
+					
+					if (::rl::mdl::Joint* joint = dynamic_cast<::rl::mdl::Joint*>(transform))
+					{
+						::std::size_t k = 0;
+						
+						while (kinematic->getJoint(k) != joint)
+						{
+							++k;
+						}
+						
+						if (nullptr != dynamic_cast<::rl::mdl::Revolute*>(joint))
+						{
+							this->bounds(offsets[k], i) = length;
+						}
+						else if (nullptr != dynamic_cast<::rl::mdl::Prismatic*>(joint))
+						{
+							this->bounds(offsets[k], i) = 1;
+							length = ::std::min(length + (joint->max(0) - joint->min(0)), ::std::numeric_limits<::rl::math::Real>::max());
+						}
+						else
+						{
+							this->bounds.col(i).setConstant(::std::numeric_limits<::rl::math::Real>::max());
+							break;
+						}
+					}
+					
+					// continue with transform leading to parent frame
+					
+					frame = transform->in;
+					j = 0;
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,94 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef RL_PLAN_CONTINUOUSVERIFIER_H
+#define RL_PLAN_CONTINUOUSVERIFIER_H
+
+#include "Verifier.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		/**
+		 * Continuous edge verification with conservative advancement.
+		 *
+		 * Certifies whole motion segments by comparing the distance of every
+		 * body to its obstacles with an upper bound on the Cartesian
+		 * displacement of the body along the segment. For revolute joints, the
+		 * bound uses the distances along the kinematic chain between the joint
+		 * axis and the bounding sphere of the body. Prismatic joints add their
+		 * full range. As robot bodies may move towards each other, only half
+		 * of the distance is used. Segments that cannot be certified are
+		 * bisected, down to the resolution given by delta.
+		 *
+		 * Requires a DistanceModel. Bounds are only available for kinematic
+		 * models of type rl::mdl with revolute and prismatic joints and for
+		 * bodies with bounding boxes, as loaded by default by
+		 * rl::sg::XmlFactory, otherwise verification falls back to bisection
+		 * down to delta.
+		 *
+		 * Stephan Schwarzer, Mitul Saha, and Jean-Claude Latombe. Adaptive
+		 * dynamic collision checking for single and multiple articulated
+		 * robots in complex environments. IEEE Transactions on Robotics,
+		 * 21(3):338-353, June 2005.
+		 */
+		class RL_PLAN_EXPORT ContinuousVerifier : public Verifier
+		{
+		public:
+			ContinuousVerifier();
+			
+			virtual ~ContinuousVerifier();
+			
+			bool isColliding(const ::rl::math::Vector& u, const ::rl::math::Vector& v, const ::rl::math::Real& d);
+			
+		protected:
+			
+		private:
+			struct Segment
+			{
+				::rl::math::Real a;
+				
+				::rl::math::Real b;
+				
+				::rl::math::Vector da;
+				
+				::rl::math::Vector db;
+			};
+			
+			void distances(::rl::math::Vector& d);
+			
+			::rl::math::Vector motion(const ::rl::math::Vector& q1, const ::rl::math::Vector& q2) const;
+			
+			void updateBounds();
+			
+			/** Displacement bound per body (columns) for a unit motion of each joint coordinate (rows). */
+			::rl::math::Matrix bounds;
+		};
+	}
+}
+
+#endif // RL_PLAN_CONTINUOUSVERIFIER_H
@@ -24,6 +24,7 @@
 // POSSIBILITY OF SUCH DAMAGE.
 //
 
+#include <cmath>
 #include <rl/sg/Body.h>
 #include <rl/sg/DistanceScene.h>
 
@@ -34,7 +35,12 @@ namespace rl
 	namespace plan
 	{
 		DistanceModel::DistanceModel() :
-			SimpleModel()
+			SimpleModel(),
+			cache(),
+			cacheHits(0),
+			cacheModelRevision(0),
+			cacheResolution(0),
+			cacheSceneRevision(0)
 		{
 		}
 		
@@ -42,9 +48,38 @@ namespace rl
 		{
 		}
 		
+		void
+		DistanceModel::clearCache()
+		{
+			this->cache.clear();
+		}
+		
 		::rl::math::Real
 		DistanceModel::distance(const ::rl::math::Vector3& point)
 		{
+			CacheKey key;
+			
+			if (this->cacheResolution > 0)
+			{
+				if (!this->isCacheValid())
+				{
+					this->cache.clear();
+				}
+				
+				for (::std::size_t i = 0; i < key.size(); ++i)
+				{
+					key[i] = static_cast<::std::int64_t>(::std::floor(point(i) / this->cacheResolution));
+				}
+				
+				::std::unordered_map<CacheKey, CacheSample, CacheHash>::const_iterator sample = this->cache.find(key);
+				
+				if (this->cache.end() != sample)
+				{
+					++this->cacheHits;
+					return sample->second.distance - (point - sample->second.point).norm();
+				}
+			}
+			
 			::rl::math::Real distance = ::std::numeric_limits<::rl::math::Real>::max();
 			::rl::math::Vector3 point1;
 			::rl::math::Vector3 point2;
@@ -57,6 +92,14 @@ namespace rl
 				}
 			}
 			
+			if (this->cacheResolution > 0)
+			{
+				CacheSample sample;
+				sample.distance = distance;
+				sample.point = point;
+				this->cache.emplace(key, sample);
+			}
+			
 			return distance;
 		}
 		
@@ -185,5 +228,76 @@ namespace rl
 				}
 			}
 		}
+		
+		::std::size_t
+		DistanceModel::getCacheHits() const
+		{
+			return this->cacheHits;
+		}
+		
+		const ::rl::math::Real&
+		DistanceModel::getCacheResolution() const
+		{
+			return this->cacheResolution;
+		}
+		
+		::std::size_t
+		DistanceModel::getCacheSize() const
+		{
+			return this->cache.size();
+		}
+		
+		bool
+		DistanceModel::isCacheValid()
+		{
+			// model revisions only increase, their sum changes with any body frame
+			// as long as the scene revision does not report a removed model
+			
+			::std::size_t modelRevision = 0;
+			
+			for (::rl::sg::Scene::Iterator i = this->scene->begin(); i != this->scene->end(); ++i)
+			{
+				if (*i != this->model)
+				{
+					modelRevision += (*i)->getRevision();
+				}
+			}
+			
+			if (this->scene->getRevision() != this->cacheSceneRevision || modelRevision != this->cacheModelRevision)
+			{
+				this->cacheModelRevision = modelRevision;
+				this->cacheSceneRevision = this->scene->getRevision();
+				return false;
+			}
+			
+			return true;
+		}
+		
+		void
+		DistanceModel::reset()
+		{
+			SimpleModel::reset();
+			this->cacheHits = 0;
+		}
+		
+		void
+		DistanceModel::setCacheResolution(const ::rl::math::Real& cacheResolution)
+		{
+			this->cacheResolution = cacheResolution;
+			this->clearCache();
+		}
+		
+		::std::size_t
+		DistanceModel::CacheHash::operator()(const CacheKey& key) const
+		{
+			::std::size_t hash = 0;
+			
+			for (::std::size_t i = 0; i < key.size(); ++i)
+			{
+				hash ^= ::std::hash<::std::int64_t>()(key[i]) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+			}
+			
+			return hash;
+		}
 	}
 }
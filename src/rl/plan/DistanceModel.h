@@ -27,6 +27,9 @@
 #ifndef RL_PLAN_DISTANCEMODEL_H
 #define RL_PLAN_DISTANCEMODEL_H
 
+#include <array>
+#include <cstdint>
+#include <unordered_map>
 #include <rl/sg/DistanceScene.h>
 
 #include "RealList.h"
@@ -44,18 +47,71 @@ namespace rl
 			
 			virtual ~DistanceModel();
 			
+			/**
+			 * Remove all cached point distances.
+			 */
+			void clearCache();
+			
 			using SimpleModel::distance;
 			
+			/**
+			 * Distance of a point to all models except the robot.
+			 *
+			 * If a cache resolution is set, the first query in each voxel is
+			 * computed exactly and stored. Later queries in the same voxel
+			 * return the lower bound d - |point - p| of the stored sample p,
+			 * as the distance field is 1-Lipschitz. The bound is off by at most
+			 * the voxel diagonal. The cache is cleared automatically as soon as
+			 * the scene changes or any obstacle body moves, as tracked by the
+			 * revisions of the scene and its models.
+			 */
 			virtual ::rl::math::Real distance(const ::rl::math::Vector3& point);
 			
 			virtual ::rl::math::Real distance(const ::std::size_t& body, ::rl::math::Vector3& point1, ::rl::math::Vector3& point2);
 			
 			virtual void distance(const ::std::size_t& body, RealList& distances, Vector3List& points1, Vector3List& points2);
 			
+			::std::size_t getCacheHits() const;
+			
+			const ::rl::math::Real& getCacheResolution() const;
+			
+			::std::size_t getCacheSize() const;
+			
+			virtual void reset();
+			
+			/**
+			 * Voxel edge length of the point distance cache, zero disables caching.
+			 */
+			void setCacheResolution(const ::rl::math::Real& cacheResolution);
+			
 		protected:
 			
 		private:
+			typedef ::std::array<::std::int64_t, 3> CacheKey;
+			
+			struct CacheHash
+			{
+				::std::size_t operator()(const CacheKey& key) const;
+			};
+			
+			struct CacheSample
+			{
+				::rl::math::Real distance;
+				
+				::rl::math::Vector3 point;
+			};
+			
+			bool isCacheValid();
+			
+			::std::unordered_map<CacheKey, CacheSample, CacheHash> cache;
+			
+			::std::size_t cacheHits;
+			
+			::std::size_t cacheModelRevision;
+			
+			::rl::math::Real cacheResolution;
 			
+			::std::size_t cacheSceneRevision;
 		};
 	}
 }
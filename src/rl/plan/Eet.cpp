@@ -68,7 +68,8 @@ namespace rl
 			randEngine(::std::random_device()()),
 			explorationTimeStart(),
 			explorationTimeStop(),
-			nn(WorkspaceMetric(&this->distanceWeight, &this->alternativeDistanceComputation))
+			nn(WorkspaceMetric(&this->distanceWeight, &this->alternativeDistanceComputation)),
+			vertices()
 		{
 		}
 		
@@ -83,7 +84,7 @@ namespace rl
 			
 			if (nullptr != this->getViewer())
 			{
-				this->getViewer()->drawConfigurationEdge(*get(tree, u)->q, *get(tree, v)->q);
+				this->getViewer()->drawConfigurationEdge(configuration(tree, u), configuration(tree, v));
 			}
 			
 			return e;
@@ -102,18 +103,14 @@ namespace rl
 		}
 		
 		Eet::Vertex
-		Eet::addVertex(Tree& tree, const VectorPtr& q)
+		Eet::addVertex(Tree& tree, const ::rl::math::Vector& q)
 		{
-			::std::shared_ptr<VertexBundle> bundle = ::std::make_shared<VertexBundle>();
-			bundle->index = ::boost::num_vertices(tree) - 1;
-			bundle->q = q;
-			
-			Vertex v = ::boost::add_vertex(tree);
-			tree[v] = bundle;
+			this->vertices.push_back(VertexBundle());
+			Vertex v = insertVertex(tree, q, &this->vertices.back());
 			
 			if (nullptr != this->getViewer())
 			{
-				this->getViewer()->drawConfigurationVertex(*get(tree, v)->q);
+				this->getViewer()->drawConfigurationVertex(q);
 			}
 			
 			return v;
@@ -134,28 +131,27 @@ namespace rl
 		Rrt::Vertex
 		Eet::connect(Tree& tree, const Neighbor& nearest, const ::rl::math::Transform& chosen)
 		{
-			::rl::math::Real distance = this->distance(*get(tree, nearest.second)->t, chosen);
+			::rl::math::Real distance = this->distance(get(tree, nearest.second)->t, chosen);
 			
 			Vertex connected = nullptr;
 			Vertex n = nearest.second;
 			int state = 1;
 			
+			::rl::math::Vector best(this->getModel()->getDofPosition());
+			::rl::math::Transform best2;
+			
 			do
 			{
-				VertexBundle best;
-				best.q = ::std::make_shared<::rl::math::Vector>(this->getModel()->getDofPosition());
-				best.t = ::std::make_shared<::rl::math::Transform>();
-				
-				state = this->expand(get(tree, n), *get(tree, nearest.second)->t, chosen, distance, best); // TODO
+				state = this->expand(configuration(tree, n), get(tree, nearest.second)->t, chosen, distance, best, best2); // TODO
 				
 				if (state >= 0)
 				{
-					connected = this->addVertex(tree, best.q);
-					get(tree, connected)->t = best.t;
+					connected = this->addVertex(tree, best);
+					get(tree, connected)->t = best2;
 					this->addEdge(n, connected, tree);
 					n = connected;
 					
-					::rl::math::Real distance2 = this->distance(*get(tree, n)->t, chosen);
+					::rl::math::Real distance2 = this->distance(get(tree, n)->t, chosen);
 					
 					if (distance2 > distance)
 					{
@@ -173,7 +169,7 @@ namespace rl
 			
 			if (nullptr != connected)
 			{
-				this->nn.push(WorkspaceMetric::Value(get(tree, connected)->t.get(), connected));
+				this->nn.push(WorkspaceMetric::Value(&get(tree, connected)->t, connected));
 			}
 			
 			return connected;
@@ -194,13 +190,13 @@ namespace rl
 		}
 		
 		int
-		Eet::expand(const VertexBundle* nearest, const ::rl::math::Transform& nearest2, const ::rl::math::Transform& chosen, const ::rl::math::Real& distance, VertexBundle& expanded)
+		Eet::expand(const ::rl::math::Vector& nearest, const ::rl::math::Transform& nearest2, const ::rl::math::Transform& chosen, const ::rl::math::Real& distance, ::rl::math::Vector& expanded, ::rl::math::Transform& expanded2)
 		{
 			int state = 1;
 			
 			::rl::math::Vector6 tdot = nearest2.toDelta(chosen, true);
 			
-			this->getModel()->setPosition(*nearest->q);
+			this->getModel()->setPosition(nearest);
 			this->getModel()->updateFrames();
 			this->getModel()->updateJacobian();
 			this->getModel()->updateJacobianInverse();
@@ -222,31 +218,31 @@ namespace rl
 				qdot *= this->getDelta();
 			}
 			
-			this->getModel()->step(*nearest->q, qdot, *expanded.q);
+			this->getModel()->step(nearest, qdot, expanded);
 			
 			if (this->getModel()->getManipulabilityMeasure() < static_cast<::rl::math::Real>(1.0e-3)) // within singularity
 			{
-				*expanded.q = this->getSampler()->generate(); // uniform sampling for singularities
-				::rl::math::Real tmp = this->getModel()->distance(*nearest->q, *expanded.q);
-				this->getModel()->interpolate(*nearest->q, *expanded.q, this->getDelta() / tmp, *expanded.q);
+				expanded = this->getSampler()->generate(); // uniform sampling for singularities
+				::rl::math::Real tmp = this->getModel()->distance(nearest, expanded);
+				this->getModel()->interpolate(nearest, expanded, this->getDelta() / tmp, expanded);
 			}
 			
-			if (!this->getModel()->isValid(*expanded.q))
+			if (!this->getModel()->isValid(expanded))
 			{
 				return -1;
 			}
 			
 			if (nullptr != this->getViewer())
 			{
-				this->getViewer()->drawConfiguration(*expanded.q);
+				this->getViewer()->drawConfiguration(expanded);
 			}
 			
-			if (this->getModel()->isColliding(*expanded.q))
+			if (this->getModel()->isColliding(expanded))
 			{
 				return -1;
 			}
 			
-			*expanded.t = this->getModel()->forwardPosition();
+			expanded2 = this->getModel()->forwardPosition();
 			
 			return state;
 		}
@@ -254,18 +250,17 @@ namespace rl
 		Rrt::Vertex
 		Eet::extend(Tree& tree, const Neighbor& nearest, const ::rl::math::Transform& chosen)
 		{
-			::rl::math::Real distance = this->distance(*get(tree, nearest.second)->t, chosen);
+			::rl::math::Real distance = this->distance(get(tree, nearest.second)->t, chosen);
 			
 			Vertex extended = nullptr;
 			
-			VertexBundle best;
-			best.q = ::std::make_shared<::rl::math::Vector>(this->getModel()->getDofPosition());
-			best.t = ::std::make_shared<::rl::math::Transform>();
+			::rl::math::Vector best(this->getModel()->getDofPosition());
+			::rl::math::Transform best2;
 			
-			if (this->expand(get(tree, nearest.second), *get(tree, nearest.second)->t, chosen, distance, best) >= 0)
+			if (this->expand(configuration(tree, nearest.second), get(tree, nearest.second)->t, chosen, distance, best, best2) >= 0)
 			{
-				extended = this->addVertex(tree, best.q);
-				get(tree, extended)->t = best.t;
+				extended = this->addVertex(tree, best);
+				get(tree, extended)->t = best2;
 				this->addEdge(nearest.second, extended, tree);
 			}
 			
@@ -281,7 +276,7 @@ namespace rl
 		Eet::VertexBundle*
 		Eet::get(const Tree& tree, const Vertex& v)
 		{
-			return static_cast<VertexBundle*>(tree[v].get());
+			return static_cast<VertexBundle*>(tree[v]);
 		}
 		
 		::rl::math::Real
@@ -404,6 +399,7 @@ namespace rl
 			}
 			
 			this->nn.clear();
+			this->vertices.clear();
 		}
 		
 		void
@@ -546,11 +542,11 @@ namespace rl
 			
 			// tree initialization with start configuration
 			
-			this->begin[0] = this->addVertex(this->tree[0], ::std::make_shared<::rl::math::Vector>(*this->getStart()));
+			this->begin[0] = this->addVertex(this->tree[0], *this->getStart());
 			this->getModel()->setPosition(*this->getStart());
 			this->getModel()->updateFrames();
-			get(this->tree[0], this->begin[0])->t = ::std::make_shared<::rl::math::Transform>(this->getModel()->forwardPosition());
-			this->nn.push(WorkspaceMetric::Value(get(this->tree[0], this->begin[0])->t.get(), begin[0]));
+			get(this->tree[0], this->begin[0])->t = this->getModel()->forwardPosition();
+			this->nn.push(WorkspaceMetric::Value(&get(this->tree[0], this->begin[0])->t, begin[0]));
 			
 			::rl::math::Transform chosen;
 			chosen.setIdentity();
@@ -562,7 +558,7 @@ namespace rl
 			WorkspaceSphereVector::iterator i = ++path.begin();
 			::rl::math::Real sigma = gamma; // initialize exploration/exploitation balance
 			
-			while ((::std::chrono::steady_clock::now() - this->time) < this->getDuration()) // search until goal reached
+			while (!this->isCanceled() && (::std::chrono::steady_clock::now() - this->time) < this->getDuration()) // search until goal reached
 			{
 				if (sigma < 1) // sample is within current sphere
 				{
@@ -599,7 +595,7 @@ namespace rl
 							
 							chosen.linear() = ::rl::math::Quaternion::Random(
 								::rl::math::Vector3(this->gauss(), this->gauss(), this->gauss()),
-								::rl::math::Quaternion((*get(this->tree[0], nearest.second)->t).linear()),
+								::rl::math::Quaternion(get(this->tree[0], nearest.second)->t.linear()),
 								::rl::math::Vector3::Constant(sigma / this->beta)
 							).toRotationMatrix();
 						}
@@ -616,7 +612,7 @@ namespace rl
 					{
 						if (this->goalEpsilonUseOrientation)
 						{
-							if (this->distance(*get(this->tree[0], connected)->t, goal) < this->goalEpsilon)
+							if (this->distance(get(this->tree[0], connected)->t, goal) < this->goalEpsilon)
 							{
 								this->end[0] = connected;
 								return true;
@@ -624,7 +620,7 @@ namespace rl
 						}
 						else
 						{
-							if ((get(this->tree[0], connected)->t->translation() - goal.translation()).norm() < this->goalEpsilon)
+							if ((get(this->tree[0], connected)->t.translation() - goal.translation()).norm() < this->goalEpsilon)
 							{
 								this->end[0] = connected;
 								return true;
@@ -636,7 +632,7 @@ namespace rl
 						
 						for (WorkspaceSphereVector::reverse_iterator k = ++path.rbegin(); k.base() != i; ++k) // search spheres backwards
 						{
-							if (((*get(this->tree[0], connected)->t).translation() - *k->center).norm() < k->radius) // position is within sphere
+							if ((get(this->tree[0], connected)->t.translation() - *k->center).norm() < k->radius) // position is within sphere
 							{
 								i = k.base(); // advance to matching sphere
 								sigma = gamma; // reset exploration/exploitation balance
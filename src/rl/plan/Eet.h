@@ -27,11 +27,11 @@
 #ifndef RL_PLAN_EET_H
 #define RL_PLAN_EET_H
 
+#include <deque>
 #include <random>
 #include <rl/math/GnatNearestNeighbors.h>
 
 #include "RrtCon.h"
-#include "TransformPtr.h"
 #include "WorkspaceMetric.h"
 
 namespace rl
@@ -173,12 +173,12 @@ namespace rl
 		protected:
 			struct VertexBundle : Rrt::VertexBundle
 			{
-				TransformPtr t;
+				::rl::math::Transform t;
 			};
 			
 			Edge addEdge(const Vertex& u, const Vertex& v, Tree& tree);
 			
-			Vertex addVertex(Tree& tree, const VectorPtr& q);
+			Vertex addVertex(Tree& tree, const ::rl::math::Vector& q);
 			
 			using RrtCon::connect;
 			
@@ -186,7 +186,7 @@ namespace rl
 			
 			::rl::math::Real distance(const ::rl::math::Transform& t1, const ::rl::math::Transform& t2) const;
 			
-			int expand(const VertexBundle* nearest, const ::rl::math::Transform& nearest2, const ::rl::math::Transform& chosen, const ::rl::math::Real& distance, VertexBundle& expanded);
+			int expand(const ::rl::math::Vector& nearest, const ::rl::math::Transform& nearest2, const ::rl::math::Transform& chosen, const ::rl::math::Real& distance, ::rl::math::Vector& expanded, ::rl::math::Transform& expanded2);
 			
 			using RrtCon::extend;
 			
@@ -216,6 +216,8 @@ namespace rl
 			::std::chrono::steady_clock::time_point explorationTimeStop;
 			
 			::rl::math::GnatNearestNeighbors<WorkspaceMetric> nn;
+			
+			::std::deque<VertexBundle, ::Eigen::aligned_allocator<VertexBundle>> vertices;
 		};
 	}
 }
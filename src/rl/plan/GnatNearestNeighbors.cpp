@@ -59,6 +59,12 @@ namespace rl
 			return this->container.getChecks();
 		}
 		
+		::rl::math::Real
+		GnatNearestNeighbors::getEpsilon() const
+		{
+			return this->container.getEpsilon();
+		}
+		
 		::std::size_t
 		GnatNearestNeighbors::getNodeDataMax() const
 		{
@@ -113,6 +119,12 @@ namespace rl
 			this->container.setChecks(checks);
 		}
 		
+		void
+		GnatNearestNeighbors::setEpsilon(const ::rl::math::Real& epsilon)
+		{
+			this->container.setEpsilon(epsilon);
+		}
+		
 		void
 		GnatNearestNeighbors::setNodeDataMax(const ::std::size_t& nodeDataMax)
 		{
@@ -50,6 +50,8 @@ namespace rl
 			
 			::boost::optional<::std::size_t> getChecks() const;
 			
+			::rl::math::Real getEpsilon() const;
+			
 			::std::size_t getNodeDataMax() const;
 			
 			::std::size_t getNodeDegree() const;
@@ -68,6 +70,8 @@ namespace rl
 			
 			void setChecks(const ::boost::optional<::std::size_t>& checks);
 			
+			void setEpsilon(const ::rl::math::Real& epsilon);
+			
 			void setNodeDataMax(const ::std::size_t& nodeDataMax);
 			
 			void setNodeDegree(const ::std::size_t& nodeDegree);
@@ -33,7 +33,8 @@ namespace rl
 	{
 		KdtreeBoundingBoxNearestNeighbors::KdtreeBoundingBoxNearestNeighbors(Model* model) :
 			NearestNeighbors(true),
-			container(Metric(model, true))
+			container(Metric(model, true)),
+			model(model)
 		{
 		}
 		
@@ -59,6 +60,12 @@ namespace rl
 			return this->container.getChecks();
 		}
 		
+		::rl::math::Real
+		KdtreeBoundingBoxNearestNeighbors::getEpsilon() const
+		{
+			return this->model->inverseOfTransformedDistance(1 + this->container.getEpsilon()) - 1;
+		}
+		
 		::std::size_t
 		KdtreeBoundingBoxNearestNeighbors::getNodeDataMax() const
 		{
@@ -89,6 +96,12 @@ namespace rl
 			this->container.setChecks(checks);
 		}
 		
+		void
+		KdtreeBoundingBoxNearestNeighbors::setEpsilon(const ::rl::math::Real& epsilon)
+		{
+			this->container.setEpsilon(this->model->transformedDistance(1 + epsilon) - 1);
+		}
+		
 		void
 		KdtreeBoundingBoxNearestNeighbors::setNodeDataMax(const ::std::size_t& nodeDataMax)
 		{
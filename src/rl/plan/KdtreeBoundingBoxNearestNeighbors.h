@@ -50,6 +50,8 @@ namespace rl
 			
 			::boost::optional<::std::size_t> getChecks() const;
 			
+			::rl::math::Real getEpsilon() const;
+			
 			::std::size_t getNodeDataMax() const;
 			
 			::std::vector<NearestNeighbors::Neighbor> nearest(const NearestNeighbors::Value& query, const ::std::size_t& k, const bool& sorted = true) const;
@@ -60,6 +62,8 @@ namespace rl
 			
 			void setChecks(const ::boost::optional<::std::size_t>& checks);
 			
+			void setEpsilon(const ::rl::math::Real& epsilon);
+			
 			void setNodeDataMax(const ::std::size_t& nodeDataMax);
 			
 			::std::size_t size() const;
@@ -68,6 +72,8 @@ namespace rl
 			
 		private:
 			::rl::math::KdtreeBoundingBoxNearestNeighbors<Metric> container;
+			
+			Model* model;
 		};
 	}
 }
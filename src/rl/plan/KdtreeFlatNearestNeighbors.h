@@ -0,0 +1,81 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef RL_PLAN_KDTREEFLATNEARESTNEIGHBORS_H
+#define RL_PLAN_KDTREEFLATNEARESTNEIGHBORS_H
+
+#include <rl/math/KdtreeFlatNearestNeighbors.h>
+
+#include "NearestNeighbors.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		class Model;
+		
+		class RL_PLAN_EXPORT KdtreeFlatNearestNeighbors : public NearestNeighbors
+		{
+		public:
+			KdtreeFlatNearestNeighbors(Model* model);
+			
+			virtual ~KdtreeFlatNearestNeighbors();
+			
+			void clear();
+			
+			bool empty() const;
+			
+			::std::size_t getBucketSize() const;
+			
+			::boost::optional<::std::size_t> getChecks() const;
+			
+			::rl::math::Real getEpsilon() const;
+			
+			::std::vector<NearestNeighbors::Neighbor> nearest(const NearestNeighbors::Value& query, const ::std::size_t& k, const bool& sorted = true) const;
+			
+			void push(const NearestNeighbors::Value& value);
+			
+			::std::vector<NearestNeighbors::Neighbor> radius(const Value& query, const Distance& radius, const bool& sorted = true) const;
+			
+			void setBucketSize(const ::std::size_t& bucketSize);
+			
+			void setChecks(const ::boost::optional<::std::size_t>& checks);
+			
+			void setEpsilon(const ::rl::math::Real& epsilon);
+			
+			::std::size_t size() const;
+			
+		protected:
+			
+		private:
+			::rl::math::KdtreeFlatNearestNeighbors<Metric> container;
+			
+			Model* model;
+		};
+	}
+}
+
+#endif // RL_PLAN_KDTREEFLATNEARESTNEIGHBORS_H
@@ -41,16 +41,41 @@ namespace rl
 		{
 		}
 		
+		const ::std::ptrdiff_t Metric::block = 256;
+		
+		void
+		Metric::distances(const Value& query, const ::rl::math::Matrix& values, Distance* distances) const
+		{
+			::rl::math::Vector d;
+			
+			if (nullptr != query.first)
+			{
+				this->model->transformedDistance(*query.first, values, d);
+			}
+			else
+			{
+				this->model->transformedDistance(::rl::math::Vector(::Eigen::Map<const ::rl::math::Vector>(query.begin(), query.size())), values, d);
+			}
+			
+			for (::std::ptrdiff_t i = 0; i < d.size(); ++i)
+			{
+				distances[i] = this->transformed ? d(i) : this->model->inverseOfTransformedDistance(d(i));
+			}
+		}
+		
 		Metric::Distance
 		Metric::operator()(const Value& lhs, const Value& rhs) const
 		{
+			::Eigen::Map<const ::rl::math::Vector> q1(lhs.begin(), lhs.size());
+			::Eigen::Map<const ::rl::math::Vector> q2(rhs.begin(), rhs.size());
+			
 			if (this->transformed)
 			{
-				return this->model->transformedDistance(*lhs.first, *rhs.first);
+				return this->model->transformedDistance(q1, q2);
 			}
 			else
 			{
-				return this->model->distance(*lhs.first, *rhs.first);
+				return this->model->distance(q1, q2);
 			}
 		}
 		
@@ -62,12 +87,24 @@ namespace rl
 		
 		Metric::Value::Value() :
 			first(),
+			index(),
+			matrix(),
 			second()
 		{
 		}
 		
 		Metric::Value::Value(const ::rl::math::Vector* first, void* second) :
 			first(first),
+			index(),
+			matrix(),
+			second(second)
+		{
+		}
+		
+		Metric::Value::Value(const ::rl::math::Matrix* matrix, const ::std::size_t& index, void* second) :
+			first(),
+			index(index),
+			matrix(matrix),
 			second(second)
 		{
 		}
@@ -75,19 +112,33 @@ namespace rl
 		const ::rl::math::Real*
 		Metric::Value::begin() const
 		{
-			return this->first->data();
+			if (nullptr != this->first)
+			{
+				return this->first->data();
+			}
+			else
+			{
+				return this->matrix->data() + this->index * this->matrix->rows();
+			}
 		}
 		
 		const ::rl::math::Real*
 		Metric::Value::end() const
 		{
-			return this->first->data() + this->first->size();
+			return this->begin() + this->size();
 		}
 		
 		::std::size_t
 		Metric::Value::size() const
 		{
-			return this->first->size();
+			if (nullptr != this->first)
+			{
+				return this->first->size();
+			}
+			else
+			{
+				return this->matrix->rows();
+			}
 		}
 	}
 }
@@ -27,6 +27,9 @@
 #ifndef RL_PLAN_METRIC_H
 #define RL_PLAN_METRIC_H
 
+#include <algorithm>
+#include <iterator>
+#include <rl/math/Matrix.h>
 #include <rl/math/Real.h>
 #include <rl/math/Vector.h>
 #include <rl/plan/export.h>
@@ -52,6 +55,14 @@ namespace rl
 				
 				Value(const ::rl::math::Vector* first, void* second);
 				
+				/**
+				 * Value referring to a column of a matrix by index.
+				 * 
+				 * The column is resolved on every access, so the matrix may
+				 * be resized while the value is stored.
+				 */
+				Value(const ::rl::math::Matrix* matrix, const ::std::size_t& index, void* second);
+				
 				const ::rl::math::Real* begin() const;
 				
 				const ::rl::math::Real* end() const;
@@ -60,6 +71,10 @@ namespace rl
 				
 				const ::rl::math::Vector* first;
 				
+				::std::size_t index;
+				
+				const ::rl::math::Matrix* matrix;
+				
 				void* second;
 			};
 			
@@ -71,9 +86,43 @@ namespace rl
 			
 			Distance operator()(const Distance& lhs, const Distance& rhs, const ::std::size_t& index) const;
 			
+			/**
+			 * Distances of a query to a range of values.
+			 * 
+			 * Values are gathered block-wise into a column-major matrix and
+			 * handed to the model with a single call per block.
+			 */
+			template<typename InputIterator>
+			void operator()(const Value& query, InputIterator first, InputIterator last, Distance* distances) const
+			{
+				::rl::math::Matrix values(query.size(), ::std::min<::std::ptrdiff_t>(::std::distance(first, last), Metric::block));
+				
+				while (first != last)
+				{
+					::std::ptrdiff_t n = 0;
+					
+					for (; first != last && n < values.cols(); ++first, ++n)
+					{
+						values.col(n) = ::Eigen::Map<const ::rl::math::Vector>(first->begin(), first->size());
+					}
+					
+					if (n < values.cols())
+					{
+						values.conservativeResize(::Eigen::NoChange, n);
+					}
+					
+					this->distances(query, values, distances);
+					distances += n;
+				}
+			}
+			
 		protected:
 			
 		private:
+			static const ::std::ptrdiff_t block;
+			
+			void distances(const Value& query, const ::rl::math::Matrix& values, Distance* distances) const;
+			
 			Model* model;
 			
 			bool transformed;
@@ -71,7 +71,7 @@ namespace rl
 		}
 		
 		::rl::math::Real
-		Model::distance(const ::rl::math::Vector& q1, const ::rl::math::Vector& q2) const
+		Model::distance(const ::rl::math::ConstVectorRef& q1, const ::rl::math::ConstVectorRef& q2) const
 		{
 			if (nullptr != this->kin)
 			{
@@ -526,7 +526,7 @@ namespace rl
 		}
 		
 		::rl::math::Real
-		Model::transformedDistance(const ::rl::math::Vector& q1, const ::rl::math::Vector& q2) const
+		Model::transformedDistance(const ::rl::math::ConstVectorRef& q1, const ::rl::math::ConstVectorRef& q2) const
 		{
 			if (nullptr != this->kin)
 			{
@@ -551,6 +551,24 @@ namespace rl
 			}
 		}
 		
+		void
+		Model::transformedDistance(const ::rl::math::Vector& q1, const ::rl::math::Matrix& q2, ::rl::math::Vector& d) const
+		{
+			if (nullptr != this->kin)
+			{
+				d.resize(q2.cols());
+				
+				for (::std::ptrdiff_t i = 0; i < q2.cols(); ++i)
+				{
+					d(i) = this->kin->transformedDistance(q1, q2.col(i));
+				}
+			}
+			else
+			{
+				this->mdl->transformedDistance(q1, q2, d);
+			}
+		}
+		
 		void
 		Model::updateFrames(const bool& doUpdateModel)
 		{
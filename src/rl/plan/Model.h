@@ -28,6 +28,7 @@
 #define RL_PLAN_MODEL_H
 
 #include <rl/kin/Kinematics.h>
+#include <rl/math/Matrix.h>
 #include <rl/math/Transform.h>
 #include <rl/math/Vector.h>
 #include <rl/mdl/Kinematic.h>
@@ -50,7 +51,7 @@ namespace rl
 			
 			virtual void clamp(::rl::math::Vector& q) const;
 			
-			virtual ::rl::math::Real distance(const ::rl::math::Vector& q1, const ::rl::math::Vector& q2) const;
+			virtual ::rl::math::Real distance(const ::rl::math::ConstVectorRef& q1, const ::rl::math::ConstVectorRef& q2) const;
 			
 			virtual void forwardForce(const ::rl::math::Vector& tau, ::rl::math::Vector& f) const;
 			
@@ -124,10 +125,12 @@ namespace rl
 			
 			virtual ::rl::math::Real transformedDistance(const ::rl::math::Real& d) const;
 			
-			virtual ::rl::math::Real transformedDistance(const ::rl::math::Vector& q1, const ::rl::math::Vector& q2) const;
+			virtual ::rl::math::Real transformedDistance(const ::rl::math::ConstVectorRef& q1, const ::rl::math::ConstVectorRef& q2) const;
 			
 			virtual ::rl::math::Real transformedDistance(const ::rl::math::Real& q1, const ::rl::math::Real& q2, const ::std::size_t& i) const;
 			
+			virtual void transformedDistance(const ::rl::math::Vector& q1, const ::rl::math::Matrix& q2, ::rl::math::Vector& d) const;
+			
 			virtual void updateFrames(const bool& doUpdateModel = true);
 			
 			virtual void updateJacobian();
@@ -39,10 +39,32 @@ namespace rl
 		{
 		}
 		
+		::boost::optional<::std::size_t>
+		NearestNeighbors::getChecks() const
+		{
+			return ::boost::none;
+		}
+		
+		::rl::math::Real
+		NearestNeighbors::getEpsilon() const
+		{
+			return 0;
+		}
+		
 		bool
 		NearestNeighbors::isTransformedDistance() const
 		{
 			return this->transformed;
 		}
+		
+		void
+		NearestNeighbors::setChecks(const ::boost::optional<::std::size_t>& checks)
+		{
+		}
+		
+		void
+		NearestNeighbors::setEpsilon(const ::rl::math::Real& epsilon)
+		{
+		}
 	}
 }
@@ -29,6 +29,7 @@
 
 #include <utility>
 #include <vector>
+#include <boost/optional.hpp>
 
 #include "Metric.h"
 
@@ -55,6 +56,24 @@ namespace rl
 			
 			virtual bool empty() const = 0;
 			
+			/**
+			 * Maximum number of values checked per query.
+			 * 
+			 * Search stops once this many distances have been evaluated and
+			 * returns the best values found so far. Unbounded by default,
+			 * ignored by exact containers.
+			 */
+			virtual ::boost::optional<::std::size_t> getChecks() const;
+			
+			/**
+			 * Approximation bound for k-nearest neighbor queries.
+			 * 
+			 * The i-th returned neighbor is at most (1 + epsilon) times as far
+			 * away as the true i-th nearest neighbor. Zero (exact search) by
+			 * default, ignored by exact containers.
+			 */
+			virtual ::rl::math::Real getEpsilon() const;
+			
 			bool isTransformedDistance() const;
 			
 			virtual ::std::vector<Neighbor> nearest(const Value& query, const ::std::size_t& k, const bool& sorted = true) const = 0;
@@ -63,6 +82,10 @@ namespace rl
 			
 			virtual ::std::vector<Neighbor> radius(const Value& query, const Distance& radius, const bool& sorted = true) const = 0;
 			
+			virtual void setChecks(const ::boost::optional<::std::size_t>& checks);
+			
+			virtual void setEpsilon(const ::rl::math::Real& epsilon);
+			
 			virtual ::std::size_t size() const = 0;
 			
 		protected:
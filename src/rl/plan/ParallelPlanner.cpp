@@ -0,0 +1,190 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+
+#include <functional>
+#include <thread>
+
+#include "ParallelPlanner.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		ParallelPlanner::ParallelPlanner() :
+			Planner(),
+			mutex(),
+			planners(),
+			winner(0)
+		{
+		}
+		
+		ParallelPlanner::~ParallelPlanner()
+		{
+		}
+		
+		void
+		ParallelPlanner::addPlanner(Planner* planner)
+		{
+			this->planners.push_back(planner);
+			this->winner = this->planners.size();
+		}
+		
+		::std::string
+		ParallelPlanner::getName() const
+		{
+			return "Parallel";
+		}
+		
+		VectorList
+		ParallelPlanner::getPath()
+		{
+			if (this->winner < this->planners.size())
+			{
+				return this->planners[this->winner]->getPath();
+			}
+			
+			return VectorList();
+		}
+		
+		Planner*
+		ParallelPlanner::getPlanner(const ::std::size_t& i) const
+		{
+			return this->planners[i];
+		}
+		
+		::std::size_t
+		ParallelPlanner::getPlanners() const
+		{
+			return this->planners.size();
+		}
+		
+		Planner*
+		ParallelPlanner::getWinner() const
+		{
+			return this->winner < this->planners.size() ? this->planners[this->winner] : nullptr;
+		}
+		
+		void
+		ParallelPlanner::reset()
+		{
+			for (::std::size_t i = 0; i < this->planners.size(); ++i)
+			{
+				this->planners[i]->reset();
+			}
+			
+			this->winner = this->planners.size();
+		}
+		
+		void
+		ParallelPlanner::run(const ::std::size_t& i, ::std::exception_ptr& exception)
+		{
+			try
+			{
+				if (this->planners[i]->solve())
+				{
+					::std::lock_guard<::std::mutex> lock(this->mutex);
+					
+					if (this->winner == this->planners.size())
+					{
+						this->winner = i;
+						
+						for (::std::size_t j = 0; j < this->planners.size(); ++j)
+						{
+							if (j != i)
+							{
+								this->planners[j]->setCanceled(true);
+							}
+						}
+					}
+				}
+			}
+			catch (...)
+			{
+				exception = ::std::current_exception();
+				
+				::std::lock_guard<::std::mutex> lock(this->mutex);
+				
+				for (::std::size_t j = 0; j < this->planners.size(); ++j)
+				{
+					if (j != i)
+					{
+						this->planners[j]->setCanceled(true);
+					}
+				}
+			}
+		}
+		
+		void
+		ParallelPlanner::setCanceled(const bool& canceled)
+		{
+			Planner::setCanceled(canceled);
+			
+			for (::std::size_t i = 0; i < this->planners.size(); ++i)
+			{
+				this->planners[i]->setCanceled(canceled);
+			}
+		}
+		
+		bool
+		ParallelPlanner::solve()
+		{
+			this->time = ::std::chrono::steady_clock::now();
+			this->winner = this->planners.size();
+			
+			for (::std::size_t i = 0; i < this->planners.size(); ++i)
+			{
+				this->planners[i]->setCanceled(this->isCanceled());
+				this->planners[i]->setDuration(this->getDuration());
+				this->planners[i]->setGoal(this->getGoal());
+				this->planners[i]->setStart(this->getStart());
+			}
+			
+			::std::vector<::std::exception_ptr> exceptions(this->planners.size());
+			::std::vector<::std::thread> threads;
+			
+			for (::std::size_t i = 0; i < this->planners.size(); ++i)
+			{
+				threads.push_back(::std::thread(&ParallelPlanner::run, this, i, ::std::ref(exceptions[i])));
+			}
+			
+			for (::std::size_t i = 0; i < threads.size(); ++i)
+			{
+				threads[i].join();
+			}
+			
+			for (::std::size_t i = 0; i < exceptions.size(); ++i)
+			{
+				if (nullptr != exceptions[i])
+				{
+					::std::rethrow_exception(exceptions[i]);
+				}
+			}
+			
+			return this->winner < this->planners.size();
+		}
+	}
+}
@@ -0,0 +1,109 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+
+#ifndef RL_PLAN_PARALLELPLANNER_H
+#define RL_PLAN_PARALLELPLANNER_H
+
+#include <exception>
+#include <mutex>
+#include <vector>
+
+#include "Planner.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		/**
+		 * OR-parallel combination of planners.
+		 *
+		 * Runs all added planners concurrently in separate threads. The first
+		 * planner to find a solution wins and cancels the others. A planner
+		 * throwing an exception also cancels the others before it is rethrown.
+		 *
+		 * As collision checking and sampling are not thread-safe, every planner
+		 * needs its own model, sampler, nearest neighbor structures and
+		 * verifier, and samplers should be seeded with different values. The
+		 * viewer is not forwarded to the planners.
+		 */
+		class RL_PLAN_EXPORT ParallelPlanner : public Planner
+		{
+		public:
+			ParallelPlanner();
+			
+			virtual ~ParallelPlanner();
+			
+			void addPlanner(Planner* planner);
+			
+			virtual ::std::string getName() const;
+			
+			/**
+			 * Get solution path of winning planner.
+			 *
+			 * Returns an empty path if no planner found a solution.
+			 *
+			 * @pre solve()
+			 */
+			virtual VectorList getPath();
+			
+			Planner* getPlanner(const ::std::size_t& i) const;
+			
+			::std::size_t getPlanners() const;
+			
+			/**
+			 * Get planner that found the solution.
+			 *
+			 * @pre solve()
+			 */
+			Planner* getWinner() const;
+			
+			virtual void reset();
+			
+			virtual void setCanceled(const bool& canceled);
+			
+			/**
+			 * Find collision free path with all planners in parallel.
+			 *
+			 * Start, goal and duration are forwarded to all planners.
+			 */
+			virtual bool solve();
+			
+		protected:
+			
+		private:
+			void run(const ::std::size_t& i, ::std::exception_ptr& exception);
+			
+			::std::mutex mutex;
+			
+			::std::vector<Planner*> planners;
+			
+			::std::size_t winner;
+		};
+	}
+}
+
+#endif // RL_PLAN_PARALLELPLANNER_H
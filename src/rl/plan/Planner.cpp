@@ -38,6 +38,7 @@ namespace rl
 			model(nullptr),
 			start(nullptr),
 			viewer(nullptr),
+			canceled(false),
 			time()
 		{
 		}
@@ -76,6 +77,18 @@ namespace rl
 			return this->viewer;
 		}
 		
+		bool
+		Planner::isCanceled() const
+		{
+			return this->canceled;
+		}
+		
+		void
+		Planner::setCanceled(const bool& canceled)
+		{
+			this->canceled = canceled;
+		}
+		
 		void
 		Planner::setDuration(const ::std::chrono::steady_clock::duration& duration)
 		{
@@ -27,6 +27,7 @@
 #ifndef RL_PLAN_PLANNER_H
 #define RL_PLAN_PLANNER_H
 
+#include <atomic>
 #include <chrono>
 #include <string>
 #include <rl/math/Vector.h>
@@ -70,11 +71,21 @@ namespace rl
 			
 			Viewer* getViewer() const;
 			
+			bool isCanceled() const;
+			
 			/**
 			 * Reset planner.
 			 */
 			virtual void reset() = 0;
 			
+			/**
+			 * Request solve() to return without solution.
+			 *
+			 * May be called from another thread while solve() is running. The
+			 * request stays active until it is withdrawn.
+			 */
+			virtual void setCanceled(const bool& canceled);
+			
 			void setDuration(const ::std::chrono::steady_clock::duration& duration);
 			
 			void setGoal(::rl::math::Vector* goal);
@@ -109,6 +120,8 @@ namespace rl
 			Viewer* viewer;
 			
 		protected:
+			::std::atomic<bool> canceled;
+			
 			::std::chrono::steady_clock::time_point time;
 			
 		private:
@@ -24,10 +24,15 @@
 // POSSIBILITY OF SUCH DAMAGE.
 //
 
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <map>
 #include <boost/graph/dijkstra_shortest_paths.hpp>
 #include <boost/graph/incremental_components.hpp>
 
 #include "BridgeSampler.h"
+#include "Exception.h"
 #include "GaussianSampler.h"
 #include "Prm.h"
 #include "Sampler.h"
@@ -45,6 +50,7 @@ namespace rl
 			astar(true),
 			degree(::std::numeric_limits<::std::size_t>::max()),
 			k(30),
+			lazy(false),
 			radius(::std::numeric_limits<::rl::math::Real>::max()),
 			sampler(nullptr),
 			verifier(nullptr),
@@ -54,18 +60,43 @@ namespace rl
 				::boost::get(&VertexBundle::parent, graph)
 			),
 			end(nullptr),
-			graph()
+			graph(),
+			candidates(),
+			condition(),
+			exceptions(),
+			generation(0),
+			mutex(),
+			pending(0),
+			samples(),
+			shutdown(false),
+			task(Task::sample),
+			threads(),
+			workers()
 		{
 		}
 		
 		Prm::~Prm()
 		{
+			{
+				::std::lock_guard<::std::mutex> lock(this->mutex);
+				this->shutdown = true;
+			}
+			
+			this->condition.notify_all();
+			
+			for (::std::size_t i = 0; i < this->threads.size(); ++i)
+			{
+				this->threads[i].join();
+			}
 		}
 		
+		const ::std::size_t Prm::batch = 16;
+		
 		Prm::Edge
 		Prm::addEdge(const Vertex& u, const Vertex& v, const ::rl::math::Real& weight)
 		{
 			Edge e = ::boost::add_edge(u, v, this->graph).first;
+			this->graph[e].verified = !this->lazy;
 			this->graph[e].weight = weight;
 			
 			this->ds.union_set(u, v);
@@ -94,15 +125,207 @@ namespace rl
 			return v;
 		}
 		
+		void
+		Prm::addWorker(Sampler* sampler, Verifier* verifier)
+		{
+			Worker worker;
+			worker.sampler = sampler;
+			worker.verifier = verifier;
+			this->workers.push_back(worker);
+		}
+		
 		void
 		Prm::construct(const ::std::size_t& steps)
 		{
-			for (::std::size_t i = 0; i < steps; ++i)
+			if (this->workers.empty())
 			{
-				VectorPtr q = ::std::make_shared<::rl::math::Vector>(this->getModel()->getDofPosition());
-				*q = this->sampler->generateCollisionFree();
-				Vertex v = this->addVertex(q);
-				this->insert(v);
+				for (::std::size_t i = 0; i < steps; ++i)
+				{
+					VectorPtr q = ::std::make_shared<::rl::math::Vector>(this->getModel()->getDofPosition());
+					*q = this->sampler->generateCollisionFree();
+					Vertex v = this->addVertex(q);
+					this->insert(v);
+				}
+				
+				return;
+			}
+			
+			for (::std::size_t i = 0; i < steps;)
+			{
+				// generate batch of samples in parallel
+				
+				this->samples.resize(::std::min(steps - i, Prm::batch * (this->workers.size() + 1)));
+				
+				for (::std::size_t j = 0; j < this->samples.size(); ++j)
+				{
+					this->samples[j] = ::std::make_shared<::rl::math::Vector>(this->getModel()->getDofPosition());
+				}
+				
+				this->dispatch(Task::sample);
+				
+				// insert vertices and collect candidate edges between components
+				
+				::std::vector<Candidate> candidates;
+				
+				for (::std::size_t j = 0; j < this->samples.size(); ++j)
+				{
+					Vertex v = this->addVertex(this->samples[j]);
+					
+					::std::vector<Neighbor> neighbors = this->graph[::boost::graph_bundle].nn->nearest(Metric::Value(this->graph[v].q.get(), v), this->k);
+					
+					for (::std::size_t l = 0; l < neighbors.size(); ++l)
+					{
+						Vertex u = neighbors[l].second.second;
+						
+						::rl::math::Real d = this->graph[::boost::graph_bundle].nn->isTransformedDistance() ? this->getModel()->inverseOfTransformedDistance(neighbors[l].first) : neighbors[l].first;
+						
+						if (d < this->radius && (this->lazy || !::boost::same_component(u, v, this->ds)))
+						{
+							Candidate candidate;
+							candidate.colliding = false;
+							candidate.u = u;
+							candidate.v = v;
+							candidate.weight = d;
+							candidates.push_back(candidate);
+						}
+					}
+					
+					this->graph[::boost::graph_bundle].nn->push(Metric::Value(this->graph[v].q.get(), v));
+				}
+				
+				i += this->samples.size();
+				
+				if (this->lazy)
+				{
+					for (::std::size_t j = 0; j < candidates.size(); ++j)
+					{
+						if (::boost::degree(candidates[j].u, this->graph) < this->degree && ::boost::degree(candidates[j].v, this->graph) < this->degree)
+						{
+							this->addEdge(candidates[j].u, candidates[j].v, candidates[j].weight);
+						}
+					}
+					
+					continue;
+				}
+				
+				// verify candidate edges in parallel, in rounds that assume all
+				// earlier candidates to be free and skip candidates within the
+				// resulting components, as the sequential insert would, skipped
+				// candidates are retried in the next round if still disconnected
+				
+				while (!candidates.empty())
+				{
+					::std::map<Vertex, Vertex> components;
+					::std::vector<Candidate> deferred;
+					
+					this->candidates.clear();
+					
+					for (::std::size_t j = 0; j < candidates.size(); ++j)
+					{
+						Vertex u = this->ds.find_set(candidates[j].u);
+						
+						for (::std::map<Vertex, Vertex>::const_iterator component = components.find(u); components.end() != component; component = components.find(u))
+						{
+							u = component->second;
+						}
+						
+						Vertex v = this->ds.find_set(candidates[j].v);
+						
+						for (::std::map<Vertex, Vertex>::const_iterator component = components.find(v); components.end() != component; component = components.find(v))
+						{
+							v = component->second;
+						}
+						
+						if (u != v)
+						{
+							components[u] = v;
+							this->candidates.push_back(candidates[j]);
+						}
+						else if (!::boost::same_component(candidates[j].u, candidates[j].v, this->ds))
+						{
+							deferred.push_back(candidates[j]);
+						}
+					}
+					
+					this->dispatch(Task::verify);
+					
+					// merge edges in order of insertion
+					
+					for (::std::size_t j = 0; j < this->candidates.size(); ++j)
+					{
+						if (this->candidates[j].colliding)
+						{
+							continue;
+						}
+						
+						if (::boost::degree(this->candidates[j].u, this->graph) >= this->degree || ::boost::degree(this->candidates[j].v, this->graph) >= this->degree)
+						{
+							continue;
+						}
+						
+						if (!::boost::same_component(this->candidates[j].u, this->candidates[j].v, this->ds))
+						{
+							this->addEdge(this->candidates[j].u, this->candidates[j].v, this->candidates[j].weight);
+						}
+					}
+					
+					candidates.swap(deferred);
+				}
+			}
+		}
+		
+		void
+		Prm::dispatch(const Task& task)
+		{
+			while (this->threads.size() < this->workers.size())
+			{
+				this->threads.push_back(::std::thread(&Prm::run, this, this->threads.size() + 1, this->generation));
+			}
+			
+			this->exceptions.assign(this->workers.size() + 1, nullptr);
+			
+			{
+				::std::lock_guard<::std::mutex> lock(this->mutex);
+				this->task = task;
+				this->pending = this->workers.size();
+				++this->generation;
+			}
+			
+			this->condition.notify_all();
+			
+			this->execute(0);
+			
+			{
+				::std::unique_lock<::std::mutex> lock(this->mutex);
+				
+				while (this->pending > 0)
+				{
+					this->condition.wait(lock);
+				}
+			}
+			
+			for (::std::size_t i = 0; i < this->exceptions.size(); ++i)
+			{
+				if (nullptr != this->exceptions[i])
+				{
+					::std::rethrow_exception(this->exceptions[i]);
+				}
+			}
+		}
+		
+		void
+		Prm::execute(const ::std::size_t& worker)
+		{
+			switch (this->task)
+			{
+			case Task::sample:
+				this->sample(0 == worker ? this->sampler : this->workers[worker - 1].sampler, worker, this->workers.size() + 1, this->samples, this->exceptions[worker]);
+				break;
+			case Task::verify:
+				this->verify(0 == worker ? this->verifier : this->workers[worker - 1].verifier, worker, this->workers.size() + 1, this->candidates, this->exceptions[worker]);
+				break;
+			default:
+				break;
 			}
 		}
 		
@@ -211,7 +434,11 @@ namespace rl
 					
 					if (d < this->radius)
 					{
-						if (!::boost::same_component(u, v, this->ds))
+						if (this->lazy)
+						{
+							this->addEdge(u, v, d);
+						}
+						else if (!::boost::same_component(u, v, this->ds))
 						{
 							if (!this->verifier->isColliding(*this->graph[u].q, *this->graph[v].q, d))
 							{
@@ -225,6 +452,109 @@ namespace rl
 			this->graph[::boost::graph_bundle].nn->push(Metric::Value(this->graph[v].q.get(), v));
 		}
 		
+		::std::size_t
+		Prm::getWorkers() const
+		{
+			return this->workers.size();
+		}
+		
+		::std::uint64_t
+		Prm::hash(const ::std::vector<::std::string>& filenames)
+		{
+			::std::uint64_t hash = 14695981039346656037ULL;
+			
+			for (::std::size_t i = 0; i < filenames.size(); ++i)
+			{
+				::std::ifstream file(filenames[i], ::std::ios::binary);
+				
+				if (!file)
+				{
+					throw Exception("rl::plan::Prm::hash() - Failed to open file '" + filenames[i] + "'");
+				}
+				
+				char buffer[4096];
+				
+				while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0)
+				{
+					for (::std::streamsize j = 0; j < file.gcount(); ++j)
+					{
+						hash ^= static_cast<unsigned char>(buffer[j]);
+						hash *= 1099511628211ULL;
+					}
+				}
+			}
+			
+			return hash;
+		}
+		
+		bool
+		Prm::isLazy() const
+		{
+			return this->lazy;
+		}
+		
+		bool
+		Prm::load(const ::std::string& filename, const ::std::uint64_t& key)
+		{
+			::std::ifstream file(filename, ::std::ios::binary);
+			
+			if (!file)
+			{
+				return false;
+			}
+			
+			FileHeader header;
+			
+			if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+			{
+				return false;
+			}
+			
+			if (0 != ::std::memcmp(header.magic, "RLPM", 4) || 1 != header.version)
+			{
+				return false;
+			}
+			
+			if (key != header.key || this->getModel()->getDofPosition() != header.dof || sizeof(::rl::math::Real) != header.real)
+			{
+				return false;
+			}
+			
+			this->reset();
+			
+			::std::vector<Vertex> vertices(header.vertices);
+			
+			for (::std::size_t i = 0; i < vertices.size(); ++i)
+			{
+				VectorPtr q = ::std::make_shared<::rl::math::Vector>(header.dof);
+				
+				if (!file.read(reinterpret_cast<char*>(q->data()), header.dof * sizeof(::rl::math::Real)))
+				{
+					this->reset();
+					throw Exception("rl::plan::Prm::load() - Unexpected end of file '" + filename + "'");
+				}
+				
+				vertices[i] = this->addVertex(q);
+				this->graph[::boost::graph_bundle].nn->push(Metric::Value(this->graph[vertices[i]].q.get(), vertices[i]));
+			}
+			
+			for (::std::size_t i = 0; i < header.edges; ++i)
+			{
+				FileEdge edge;
+				
+				if (!file.read(reinterpret_cast<char*>(&edge), sizeof(edge)) || edge.u >= vertices.size() || edge.v >= vertices.size())
+				{
+					this->reset();
+					throw Exception("rl::plan::Prm::load() - Invalid edge in file '" + filename + "'");
+				}
+				
+				Edge e = this->addEdge(vertices[edge.u], vertices[edge.v], edge.weight);
+				this->graph[e].verified = 0 != edge.verified;
+			}
+			
+			return true;
+		}
+		
 		void
 		Prm::reset()
 		{
@@ -234,6 +564,112 @@ namespace rl
 			this->end = nullptr;
 		}
 		
+		void
+		Prm::run(const ::std::size_t& worker, ::std::size_t generation)
+		{
+			while (true)
+			{
+				{
+					::std::unique_lock<::std::mutex> lock(this->mutex);
+					
+					while (!this->shutdown && generation == this->generation)
+					{
+						this->condition.wait(lock);
+					}
+					
+					if (this->shutdown)
+					{
+						return;
+					}
+					
+					generation = this->generation;
+				}
+				
+				this->execute(worker);
+				
+				{
+					::std::lock_guard<::std::mutex> lock(this->mutex);
+					--this->pending;
+				}
+				
+				this->condition.notify_all();
+			}
+		}
+		
+		void
+		Prm::sample(Sampler* sampler, const ::std::size_t& first, const ::std::size_t& stride, ::std::vector<VectorPtr>& samples, ::std::exception_ptr& exception)
+		{
+			try
+			{
+				for (::std::size_t i = first; i < samples.size(); i += stride)
+				{
+					*samples[i] = sampler->generateCollisionFree();
+				}
+			}
+			catch (...)
+			{
+				exception = ::std::current_exception();
+			}
+		}
+		
+		void
+		Prm::save(const ::std::string& filename, const ::std::uint64_t& key) const
+		{
+			::std::ofstream file(filename, ::std::ios::binary);
+			
+			if (!file)
+			{
+				throw Exception("rl::plan::Prm::save() - Failed to open file '" + filename + "'");
+			}
+			
+			FileHeader header;
+			::std::memcpy(header.magic, "RLPM", 4);
+			header.version = 1;
+			header.key = key;
+			header.dof = this->getModel()->getDofPosition();
+			header.vertices = ::boost::num_vertices(this->graph);
+			header.edges = ::boost::num_edges(this->graph);
+			header.real = sizeof(::rl::math::Real);
+			header.reserved = 0;
+			
+			file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			
+			// vertex indices are assigned in insertion order and vertices are never removed
+			
+			::std::vector<Vertex> vertices(header.vertices);
+			
+			for (VertexIteratorPair i = ::boost::vertices(this->graph); i.first != i.second; ++i.first)
+			{
+				vertices[this->graph[*i.first].index] = *i.first;
+			}
+			
+			for (::std::size_t i = 0; i < vertices.size(); ++i)
+			{
+				file.write(reinterpret_cast<const char*>(this->graph[vertices[i]].q->data()), header.dof * sizeof(::rl::math::Real));
+			}
+			
+			for (EdgeIteratorPair i = ::boost::edges(this->graph); i.first != i.second; ++i.first)
+			{
+				FileEdge edge;
+				edge.u = this->graph[::boost::source(*i.first, this->graph)].index;
+				edge.v = this->graph[::boost::target(*i.first, this->graph)].index;
+				edge.weight = this->graph[*i.first].weight;
+				edge.verified = this->graph[*i.first].verified ? 1 : 0;
+				file.write(reinterpret_cast<const char*>(&edge), sizeof(edge));
+			}
+			
+			if (!file)
+			{
+				throw Exception("rl::plan::Prm::save() - Failed to write file '" + filename + "'");
+			}
+		}
+		
+		void
+		Prm::setLazy(const bool& lazy)
+		{
+			this->lazy = lazy;
+		}
+		
 		void
 		Prm::setMaxDegree(const ::std::size_t& degree)
 		{
@@ -287,16 +723,37 @@ namespace rl
 			this->end = this->addVertex(::std::make_shared<::rl::math::Vector>(*this->getGoal()));
 			this->insert(this->end);
 			
-			while ((::std::chrono::steady_clock::now() - this->time) < this->getDuration() && !::boost::same_component(this->begin, this->end, this->ds))
+			while (true)
 			{
+				while (!this->isCanceled() && (::std::chrono::steady_clock::now() - this->time) < this->getDuration() && !::boost::same_component(this->begin, this->end, this->ds))
+				{
+					this->construct(this->workers.empty() ? 1 : Prm::batch * (this->workers.size() + 1));
+				}
+				
+				if (!::boost::same_component(this->begin, this->end, this->ds))
+				{
+					return false;
+				}
+				
+				if (this->search() && (!this->lazy || this->validate()))
+				{
+					return true;
+				}
+				
+				// components are not split when invalid edges are removed
+				
+				if (this->isCanceled() || (::std::chrono::steady_clock::now() - this->time) >= this->getDuration())
+				{
+					return false;
+				}
+				
 				this->construct(1);
 			}
-			
-			if (!::boost::same_component(this->begin, this->end, this->ds))
-			{
-				return false;
-			}
-			
+		}
+		
+		bool
+		Prm::search()
+		{
 			if (this->astar)
 			{
 				::boost::astar_search(
@@ -333,7 +790,50 @@ namespace rl
 				);
 			}
 			
-			return true;
+			return this->graph[this->end].predecessor != this->end;
+		}
+		
+		bool
+		Prm::validate()
+		{
+			bool valid = true;
+			
+			for (Vertex v = this->end; v != this->begin; v = this->graph[v].predecessor)
+			{
+				Vertex u = this->graph[v].predecessor;
+				Edge e = ::boost::edge(u, v, this->graph).first;
+				
+				if (!this->graph[e].verified)
+				{
+					if (this->verifier->isColliding(*this->graph[u].q, *this->graph[v].q, this->graph[e].weight))
+					{
+						::boost::remove_edge(e, this->graph);
+						valid = false;
+					}
+					else
+					{
+						this->graph[e].verified = true;
+					}
+				}
+			}
+			
+			return valid;
+		}
+		
+		void
+		Prm::verify(Verifier* verifier, const ::std::size_t& first, const ::std::size_t& stride, ::std::vector<Candidate>& candidates, ::std::exception_ptr& exception)
+		{
+			try
+			{
+				for (::std::size_t i = first; i < candidates.size(); i += stride)
+				{
+					candidates[i].colliding = verifier->isColliding(*this->graph[candidates[i].u].q, *this->graph[candidates[i].v].q, candidates[i].weight);
+				}
+			}
+			catch (...)
+			{
+				exception = ::std::current_exception();
+			}
 		}
 		
 		Prm::AStarHeuristic::AStarHeuristic(const Model* model, const Graph& graph, const Vertex& goal) :
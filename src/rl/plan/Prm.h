@@ -27,6 +27,13 @@
 #ifndef RL_PLAN_PRM_H
 #define RL_PLAN_PRM_H
 
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/astar_search.hpp>
 #include <boost/pending/disjoint_sets.hpp>
@@ -74,6 +81,22 @@ namespace rl
 			
 			virtual ~Prm();
 			
+			/**
+			 * Add worker for parallel roadmap construction.
+			 *
+			 * With additional workers, construct() generates samples and verifies
+			 * candidate edges in batches on one thread per worker, using the
+			 * planner's own sampler and verifier in the calling thread. Worker
+			 * threads are started on first use and kept until the planner is
+			 * destroyed. As in sequential construction, candidate edges within
+			 * a connected component are not verified. As sampling and collision
+			 * checking are not thread-safe, every worker needs its own model,
+			 * sampler and verifier, and samplers should be seeded with different
+			 * values. Vertices and edges are merged into the roadmap by the
+			 * calling thread. Not supported by PrmUtilityGuided.
+			 */
+			void addWorker(Sampler* sampler, Verifier* verifier);
+			
 			virtual void construct(const ::std::size_t& steps);
 			
 			::std::size_t getMaxDegree() const;
@@ -98,8 +121,45 @@ namespace rl
 			
 			Verifier* getVerifier() const;
 			
+			::std::size_t getWorkers() const;
+			
+			/**
+			 * Hash file contents for use as roadmap key.
+			 *
+			 * Computes a 64-bit FNV-1a hash over the contents of all files, e.g.,
+			 * the kinematics and scene descriptions a roadmap was built for.
+			 */
+			static ::std::uint64_t hash(const ::std::vector<::std::string>& filenames);
+			
+			bool isLazy() const;
+			
+			/**
+			 * Load roadmap saved with save().
+			 *
+			 * Replaces the current roadmap, rebuilds nearest neighbor structure and
+			 * connected components, and can be extended with construct().
+			 *
+			 * @return false if the file cannot be opened or was saved with a
+			 * different key, number of degrees of freedom or scalar type
+			 */
+			bool load(const ::std::string& filename, const ::std::uint64_t& key = 0);
+			
 			void reset();
 			
+			/**
+			 * Save roadmap in binary format.
+			 *
+			 * A fixed-size header is followed by all configurations as contiguous
+			 * arrays of scalars and by all edges with vertex indices, weight and
+			 * verification state, all in host byte order. This allows loading by
+			 * memory mapping.
+			 *
+			 * @param[in] key Identifies the environment, e.g., from hash()
+			 */
+			void save(const ::std::string& filename, const ::std::uint64_t& key = 0) const;
+			
+			void setLazy(const bool& lazy);
+			
 			void setMaxDegree(const ::std::size_t& degree);
 			
 			void setMaxNeighbors(const ::std::size_t& k);
@@ -124,6 +184,20 @@ namespace rl
 			/** Maximum number of tested neighbors. */
 			::std::size_t k;
 			
+			/**
+			 * Defer edge validation to query time.
+			 *
+			 * Edges are inserted unchecked, only edges on a candidate path are
+			 * validated and invalid edges are removed before searching again.
+			 * Not supported by PrmUtilityGuided, which samples between
+			 * disconnected components.
+			 *
+			 * Robert Bohlin and Lydia E. Kavraki. Path planning using lazy PRM. In
+			 * Proceedings of the IEEE International Conference on Robotics and
+			 * Automation, pages 521-528, San Francisco, CA, USA, April 2000.
+			 */
+			bool lazy;
+			
 			/** Maximum radius for connecting neighbors. */
 			::rl::math::Real radius;
 			
@@ -134,6 +208,8 @@ namespace rl
 		protected:
 			struct EdgeBundle
 			{
+				bool verified;
+				
 				::rl::math::Real weight;
 			};
 			
@@ -218,6 +294,10 @@ namespace rl
 			
 			void insert(const Vertex& vertex);
 			
+			bool search();
+			
+			bool validate();
+			
 			Vertex begin;
 			
 			::boost::disjoint_sets<VertexRankMap, VertexParentMap> ds;
@@ -227,7 +307,93 @@ namespace rl
 			Graph graph;
 			
 		private:
+			struct Candidate
+			{
+				bool colliding;
+				
+				Vertex u;
+				
+				Vertex v;
+				
+				::rl::math::Real weight;
+			};
+			
+			struct FileEdge
+			{
+				::std::uint64_t u;
+				
+				::std::uint64_t v;
+				
+				::rl::math::Real weight;
+				
+				::std::uint64_t verified;
+			};
+			
+			struct FileHeader
+			{
+				char magic[4];
+				
+				::std::uint32_t version;
+				
+				::std::uint64_t key;
+				
+				::std::uint64_t dof;
+				
+				::std::uint64_t vertices;
+				
+				::std::uint64_t edges;
+				
+				::std::uint32_t real;
+				
+				::std::uint32_t reserved;
+			};
+			
+			enum class Task
+			{
+				sample,
+				verify
+			};
+			
+			struct Worker
+			{
+				Sampler* sampler;
+				
+				Verifier* verifier;
+			};
+			
+			void dispatch(const Task& task);
+			
+			void execute(const ::std::size_t& worker);
+			
+			void run(const ::std::size_t& worker, ::std::size_t generation);
+			
+			void sample(Sampler* sampler, const ::std::size_t& first, const ::std::size_t& stride, ::std::vector<VectorPtr>& samples, ::std::exception_ptr& exception);
+			
+			void verify(Verifier* verifier, const ::std::size_t& first, const ::std::size_t& stride, ::std::vector<Candidate>& candidates, ::std::exception_ptr& exception);
+			
+			static const ::std::size_t batch;
+			
+			::std::vector<Candidate> candidates;
+			
+			::std::condition_variable condition;
+			
+			::std::vector<::std::exception_ptr> exceptions;
+			
+			::std::size_t generation;
+			
+			::std::mutex mutex;
+			
+			::std::size_t pending;
+			
+			::std::vector<VectorPtr> samples;
+			
+			bool shutdown;
+			
+			Task task;
+			
+			::std::vector<::std::thread> threads;
 			
+			::std::vector<Worker> workers;
 		};
 	}
 }
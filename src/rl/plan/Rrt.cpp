@@ -40,7 +40,11 @@ namespace rl
 			sampler(nullptr),
 			begin(trees, nullptr),
 			end(trees, nullptr),
-			tree(trees)
+			tree(trees),
+			from(),
+			last(),
+			next(),
+			vertices()
 		{
 		}
 		
@@ -55,34 +59,30 @@ namespace rl
 			
 			if (nullptr != this->getViewer())
 			{
-				this->getViewer()->drawConfigurationEdge(*get(tree, u)->q, *get(tree, v)->q);
+				this->getViewer()->drawConfigurationEdge(configuration(tree, u), configuration(tree, v));
 			}
 			
 			return e;
 		}
 		
 		Rrt::Vertex
-		Rrt::addVertex(Tree& tree, const VectorPtr& q)
+		Rrt::addVertex(Tree& tree, const ::rl::math::Vector& q)
 		{
-			::std::shared_ptr<VertexBundle> bundle = ::std::make_shared<VertexBundle>();
-			bundle->index = ::boost::num_vertices(tree) - 1;
-			bundle->q = q;
+			this->vertices.push_back(VertexBundle());
+			Vertex v = insertVertex(tree, q, &this->vertices.back());
 			
-			Vertex v = ::boost::add_vertex(tree);
-			tree[v] = bundle;
-			
-			tree[::boost::graph_bundle].nn->push(Metric::Value(q.get(), v));
+			tree[::boost::graph_bundle].nn->push(Metric::Value(&tree[::boost::graph_bundle].configurations, get(tree, v)->index, v));
 			
 			if (nullptr != this->getViewer())
 			{
-				this->getViewer()->drawConfigurationVertex(*get(tree, v)->q);
+				this->getViewer()->drawConfigurationVertex(q);
 			}
 			
 			return v;
 		}
 		
 		bool
-		Rrt::areEqual(const ::rl::math::Vector& lhs, const ::rl::math::Vector& rhs) const
+		Rrt::areEqual(const ::rl::math::ConstVectorRef& lhs, const ::rl::math::ConstVectorRef& rhs) const
 		{
 			if (this->getModel()->distance(lhs, rhs) > this->epsilon)
 			{
@@ -100,6 +100,12 @@ namespace rl
 			return this->sampler->generate();
 		}
 		
+		::rl::math::Matrix::ConstColXpr
+		Rrt::configuration(const Tree& tree, const Vertex& v)
+		{
+			return tree[::boost::graph_bundle].configurations.col(get(tree, v)->index);
+		}
+		
 		Rrt::Vertex
 		Rrt::connect(Tree& tree, const Neighbor& nearest, const ::rl::math::Vector& chosen)
 		{
@@ -117,21 +123,22 @@ namespace rl
 				step = this->delta;
 			}
 			
-			VectorPtr last = ::std::make_shared<::rl::math::Vector>(this->getModel()->getDofPosition());
+			this->from = configuration(tree, nearest.second);
+			this->last.resize(this->getModel()->getDofPosition());
 			
-			this->getModel()->interpolate(*get(tree, nearest.second)->q, chosen, step / distance, *last);
+			this->getModel()->interpolate(this->from, chosen, step / distance, this->last);
 			
 			if (nullptr != this->getViewer())
 			{
-//				this->getViewer()->drawConfiguration(*last);
+//				this->getViewer()->drawConfiguration(this->last);
 			}
 			
-			if (this->getModel()->isColliding(*last))
+			if (this->getModel()->isColliding(this->last))
 			{
 				return nullptr;
 			}
 			
-			::rl::math::Vector next(this->getModel()->getDofPosition());
+			this->next.resize(this->getModel()->getDofPosition());
 			
 			while (!reached)
 			{
@@ -143,22 +150,22 @@ namespace rl
 					step = distance;
 				}
 				
-				this->getModel()->interpolate(*get(tree, nearest.second)->q, chosen, step / distance, next);
+				this->getModel()->interpolate(this->from, chosen, step / distance, this->next);
 				
 				if (nullptr != this->getViewer())
 				{
-//					this->getViewer()->drawConfiguration(next);
+//					this->getViewer()->drawConfiguration(this->next);
 				}
 				
-				if (this->getModel()->isColliding(next))
+				if (this->getModel()->isColliding(this->next))
 				{
 					break;
 				}
 				
-				*last = next;
+				this->last = this->next;
 			}
 			
-			Vertex connected = this->addVertex(tree, last);
+			Vertex connected = this->addVertex(tree, this->last);
 			this->addEdge(nearest.second, connected, tree);
 			return connected;
 		}
@@ -169,13 +176,14 @@ namespace rl
 			::rl::math::Real distance = nearest.first;
 			::rl::math::Real step = ::std::min(distance, this->delta);
 			
-			VectorPtr next = ::std::make_shared<::rl::math::Vector>(this->getModel()->getDofPosition());
+			this->from = configuration(tree, nearest.second);
+			this->next.resize(this->getModel()->getDofPosition());
 			
-			this->getModel()->interpolate(*get(tree, nearest.second)->q, chosen, step / distance, *next);
+			this->getModel()->interpolate(this->from, chosen, step / distance, this->next);
 			
-			if (!this->getModel()->isColliding(*next))
+			if (!this->getModel()->isColliding(this->next))
 			{
-				Vertex extended = this->addVertex(tree, next);
+				Vertex extended = this->addVertex(tree, this->next);
 				this->addEdge(nearest.second, extended, tree);
 				return extended;
 			}
@@ -186,7 +194,7 @@ namespace rl
 		Rrt::VertexBundle*
 		Rrt::get(const Tree& tree, const Vertex& v)
 		{
-			return tree[v].get();
+			return tree[v];
 		}
 		
 		::rl::math::Real
@@ -248,11 +256,11 @@ namespace rl
 			
 			while (::boost::in_degree(i, this->tree[0]) > 0)
 			{
-				path.push_front(*get(this->tree[0], i)->q);
+				path.push_front(configuration(this->tree[0], i));
 				i = ::boost::source(*::boost::in_edges(i, this->tree[0]).first, this->tree[0]);
 			}
 			
-			path.push_front(*get(this->tree[0], i)->q);
+			path.push_front(configuration(this->tree[0], i));
 			
 			return path;
 		}
@@ -263,6 +271,23 @@ namespace rl
 			return this->sampler;
 		}
 		
+		Rrt::Vertex
+		Rrt::insertVertex(Tree& tree, const ::rl::math::Vector& q, VertexBundle* bundle)
+		{
+			::rl::math::Matrix& configurations = tree[::boost::graph_bundle].configurations;
+			
+			bundle->index = ::boost::num_vertices(tree);
+			
+			if (configurations.rows() != q.size() || configurations.cols() <= static_cast<::std::ptrdiff_t>(bundle->index))
+			{
+				configurations.conservativeResize(q.size(), ::std::max<::std::ptrdiff_t>(2 * configurations.cols(), 64));
+			}
+			
+			configurations.col(bundle->index) = q;
+			
+			return ::boost::add_vertex(bundle, tree);
+		}
+		
 		Rrt::Neighbor
 		Rrt::nearest(const Tree& tree, const ::rl::math::Vector& chosen)
 		{
@@ -283,6 +308,8 @@ namespace rl
 				this->begin[i] = nullptr;
 				this->end[i] = nullptr;
 			}
+			
+			this->vertices.clear();
 		}
 		void
 		Rrt::setDelta(const ::rl::math::Real& delta)
@@ -313,9 +340,9 @@ namespace rl
 		{
 			this->time = ::std::chrono::steady_clock::now();
 			
-			this->begin[0] = this->addVertex(this->tree[0], ::std::make_shared<::rl::math::Vector>(*this->getStart()));
+			this->begin[0] = this->addVertex(this->tree[0], *this->getStart());
 			
-			while ((::std::chrono::steady_clock::now() - this->time) < this->getDuration())
+			while (!this->isCanceled() && (::std::chrono::steady_clock::now() - this->time) < this->getDuration())
 			{
 				::rl::math::Vector chosen = this->choose();
 				Neighbor nearest = this->nearest(this->tree[0], chosen);
@@ -323,7 +350,7 @@ namespace rl
 				
 				if (nullptr != extended)
 				{
-					if (this->areEqual(*get(this->tree[0], extended)->q, *this->getGoal()))
+					if (this->areEqual(configuration(this->tree[0], extended), *this->getGoal()))
 					{
 						this->end[0] = extended;
 						return true;
@@ -27,6 +27,7 @@
 #ifndef RL_PLAN_RRT_H
 #define RL_PLAN_RRT_H
 
+#include <deque>
 #include <memory>
 #include <boost/graph/adjacency_list.hpp>
 
@@ -97,9 +98,8 @@ namespace rl
 		protected:
 			struct VertexBundle
 			{
+				/** Column of the configuration in the tree matrix. */
 				::std::size_t index;
-				
-				VectorPtr q;
 			};
 			
 			struct TreeBundle;
@@ -108,7 +108,7 @@ namespace rl
 				::boost::listS,
 				::boost::listS,
 				::boost::bidirectionalS,
-				::std::shared_ptr<VertexBundle>,
+				VertexBundle*,
 				::boost::no_property,
 				TreeBundle
 			> Tree;
@@ -122,6 +122,14 @@ namespace rl
 			
 			struct TreeBundle
 			{
+				/**
+				 * Configurations of all vertices, one column per vertex index.
+				 * 
+				 * Capacity grows geometrically, nearest neighbors refer to
+				 * columns by index via Metric::Value.
+				 */
+				::rl::math::Matrix configurations;
+				
 				NearestNeighbors* nn;
 			};
 			
@@ -139,18 +147,29 @@ namespace rl
 			
 			virtual Edge addEdge(const Vertex& u, const Vertex& v, Tree& tree);
 			
-			virtual Vertex addVertex(Tree& tree, const VectorPtr& q);
+			virtual Vertex addVertex(Tree& tree, const ::rl::math::Vector& q);
 			
-			bool areEqual(const ::rl::math::Vector& lhs, const ::rl::math::Vector& rhs) const;
+			bool areEqual(const ::rl::math::ConstVectorRef& lhs, const ::rl::math::ConstVectorRef& rhs) const;
 			
 			virtual ::rl::math::Vector choose();
 			
+			static ::rl::math::Matrix::ConstColXpr configuration(const Tree& tree, const Vertex& v);
+			
 			virtual Vertex connect(Tree& tree, const Neighbor& nearest, const ::rl::math::Vector& chosen);
 			
 			virtual Vertex extend(Tree& tree, const Neighbor& nearest, const ::rl::math::Vector& chosen);
 			
 			static VertexBundle* get(const Tree& tree, const Vertex& v);
 			
+			/**
+			 * Adds a vertex with a pooled bundle to the tree.
+			 * 
+			 * Copies q into the configuration matrix of the tree and sets the
+			 * index of the bundle. Used by all addVertex() implementations,
+			 * which own the pool of their bundle type.
+			 */
+			static Vertex insertVertex(Tree& tree, const ::rl::math::Vector& q, VertexBundle* bundle);
+			
 			virtual Neighbor nearest(const Tree& tree, const ::rl::math::Vector& chosen);
 			
 			::std::vector<Vertex> begin;
@@ -160,7 +179,13 @@ namespace rl
 			::std::vector<Tree> tree;
 			
 		private:
+			::rl::math::Vector from;
+			
+			::rl::math::Vector last;
+			
+			::rl::math::Vector next;
 			
+			::std::deque<VertexBundle> vertices;
 		};
 	}
 }
@@ -55,21 +55,21 @@ namespace rl
 			
 			while (::boost::in_degree(i, this->tree[0]) > 0)
 			{
-				path.push_front(*get(this->tree[0], i)->q);
+				path.push_front(configuration(this->tree[0], i));
 				i = ::boost::source(*::boost::in_edges(i, this->tree[0]).first, this->tree[0]);
 			}
 			
-			path.push_front(*get(this->tree[0], i)->q);
+			path.push_front(configuration(this->tree[0], i));
 			
 			i = ::boost::source(*::boost::in_edges(this->end[1], this->tree[1]).first, this->tree[1]);
 			
 			while (::boost::in_degree(i, this->tree[1]) > 0)
 			{
-				path.push_back(*get(this->tree[1], i)->q);
+				path.push_back(configuration(this->tree[1], i));
 				i = ::boost::source(*::boost::in_edges(i, this->tree[1]).first, this->tree[1]);
 			}
 			
-			path.push_back(*get(this->tree[1], i)->q);
+			path.push_back(configuration(this->tree[1], i));
 			
 			return path;
 		}
@@ -79,10 +79,10 @@ namespace rl
 		{
 			this->time = ::std::chrono::steady_clock::now();
 			
-			this->begin[0] = this->addVertex(this->tree[0], ::std::make_shared<::rl::math::Vector>(*this->getStart()));
-			this->begin[1] = this->addVertex(this->tree[1], ::std::make_shared<::rl::math::Vector>(*this->getGoal()));
+			this->begin[0] = this->addVertex(this->tree[0], *this->getStart());
+			this->begin[1] = this->addVertex(this->tree[1], *this->getGoal());
 			
-			while ((::std::chrono::steady_clock::now() - this->time) < this->getDuration())
+			while (!this->isCanceled() && (::std::chrono::steady_clock::now() - this->time) < this->getDuration())
 			{
 				::rl::math::Vector chosen = this->choose();
 				Neighbor nearest = this->nearest(this->tree[0], chosen);
@@ -95,7 +95,7 @@ namespace rl
 					
 					if (nullptr != extended2)
 					{
-						if (this->areEqual(*get(this->tree[0], extended)->q, *get(this->tree[1], extended2)->q))
+						if (this->areEqual(configuration(this->tree[0], extended), configuration(this->tree[1], extended2)))
 						{
 							this->end[0] = extended;
 							this->end[1] = extended2;
@@ -51,13 +51,13 @@ namespace rl
 		{
 			this->time = ::std::chrono::steady_clock::now();
 			
-			this->begin[0] = this->addVertex(this->tree[0], ::std::make_shared<::rl::math::Vector>(*this->getStart()));
-			this->begin[1] = this->addVertex(this->tree[1], ::std::make_shared<::rl::math::Vector>(*this->getGoal()));
+			this->begin[0] = this->addVertex(this->tree[0], *this->getStart());
+			this->begin[1] = this->addVertex(this->tree[1], *this->getGoal());
 			
 			Tree* a = &this->tree[0];
 			Tree* b = &this->tree[1];
 			
-			while ((::std::chrono::steady_clock::now() - this->time) < this->getDuration())
+			while (!this->isCanceled() && (::std::chrono::steady_clock::now() - this->time) < this->getDuration())
 			{
 				for (::std::size_t j = 0; j < 2; ++j)
 				{
@@ -67,12 +67,14 @@ namespace rl
 					
 					if (nullptr != aExtended)
 					{
-						Neighbor bNearest = this->nearest(*b, *get(*a, aExtended)->q);
-						Vertex bConnected = this->connect(*b, bNearest, *get(*a, aExtended)->q);
+						chosen = configuration(*a, aExtended);
+						
+						Neighbor bNearest = this->nearest(*b, chosen);
+						Vertex bConnected = this->connect(*b, bNearest, chosen);
 						
 						if (nullptr != bConnected)
 						{
-							if (this->areEqual(*get(*a, aExtended)->q, *get(*b, bConnected)->q))
+							if (this->areEqual(configuration(*a, aExtended), configuration(*b, bConnected)))
 							{
 								this->end[0] = &this->tree[0] == a ? aExtended : bConnected;
 								this->end[1] = &this->tree[1] == b ? bConnected : aExtended;
@@ -0,0 +1,285 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <utility>
+
+#include "ShortcutOptimizer.h"
+#include "SimpleModel.h"
+#include "Verifier.h"
+#include "Viewer.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		ShortcutOptimizer::ShortcutOptimizer() :
+			Optimizer(),
+			batch(16),
+			duration(::std::chrono::seconds(1)),
+			randDistribution(0, 1),
+			randEngine(::std::random_device()()),
+			workers()
+		{
+		}
+		
+		ShortcutOptimizer::~ShortcutOptimizer()
+		{
+		}
+		
+		void
+		ShortcutOptimizer::addWorker(Verifier* verifier)
+		{
+			this->workers.push_back(verifier);
+		}
+		
+		::std::size_t
+		ShortcutOptimizer::getBatch() const
+		{
+			return this->batch;
+		}
+		
+		::std::chrono::steady_clock::duration
+		ShortcutOptimizer::getDuration() const
+		{
+			return this->duration;
+		}
+		
+		::std::size_t
+		ShortcutOptimizer::getWorkers() const
+		{
+			return this->workers.size();
+		}
+		
+		void
+		ShortcutOptimizer::process(VectorList& path)
+		{
+			::std::chrono::steady_clock::time_point start = ::std::chrono::steady_clock::now();
+			
+			::std::vector<::rl::math::Vector> waypoints(path.begin(), path.end());
+			
+			::std::vector<Verifier*> verifiers(1, this->getVerifier());
+			verifiers.insert(verifiers.end(), this->workers.begin(), this->workers.end());
+			
+			::std::vector<::std::exception_ptr> exceptions(verifiers.size());
+			::std::vector<::std::thread> threads;
+			threads.reserve(verifiers.size());
+			
+			while (waypoints.size() > 2 && ::std::chrono::steady_clock::now() - start < this->duration)
+			{
+				::std::vector<::rl::math::Real> lengths(waypoints.size(), 0);
+				
+				for (::std::size_t i = 1; i < waypoints.size(); ++i)
+				{
+					lengths[i] = lengths[i - 1] + this->getModel()->distance(waypoints[i - 1], waypoints[i]);
+				}
+				
+				// draw random pairs of points on different path segments
+				
+				::std::vector<Candidate> candidates;
+				
+				for (::std::size_t i = 0; i < this->batch * verifiers.size(); ++i)
+				{
+					::rl::math::Real s0 = this->rand() * lengths.back();
+					::rl::math::Real s1 = this->rand() * lengths.back();
+					
+					if (s0 > s1)
+					{
+						::std::swap(s0, s1);
+					}
+					
+					Candidate candidate;
+					candidate.colliding = false;
+					candidate.i = ::std::min<::std::size_t>(::std::upper_bound(lengths.begin(), lengths.end(), s0) - lengths.begin(), waypoints.size() - 1) - 1;
+					candidate.j = ::std::min<::std::size_t>(::std::upper_bound(lengths.begin(), lengths.end(), s1) - lengths.begin(), waypoints.size() - 1) - 1;
+					
+					if (candidate.i == candidate.j)
+					{
+						continue;
+					}
+					
+					candidate.q0.resize(this->getModel()->getDofPosition());
+					candidate.q1.resize(this->getModel()->getDofPosition());
+					
+					this->getModel()->interpolate(
+						waypoints[candidate.i],
+						waypoints[candidate.i + 1],
+						(s0 - lengths[candidate.i]) / (lengths[candidate.i + 1] - lengths[candidate.i]),
+						candidate.q0
+					);
+					
+					this->getModel()->interpolate(
+						waypoints[candidate.j],
+						waypoints[candidate.j + 1],
+						(s1 - lengths[candidate.j]) / (lengths[candidate.j + 1] - lengths[candidate.j]),
+						candidate.q1
+					);
+					
+					candidate.distance = this->getModel()->distance(candidate.q0, candidate.q1);
+					candidate.gain = s1 - s0 - candidate.distance;
+					
+					if (candidate.gain > ::std::numeric_limits<::rl::math::Real>::epsilon() * lengths.back())
+					{
+						candidates.push_back(candidate);
+					}
+				}
+				
+				// verify candidate shortcuts in parallel
+				
+				if (verifiers.size() > 1)
+				{
+					for (::std::size_t i = 0; i < verifiers.size(); ++i)
+					{
+						threads.push_back(::std::thread(&ShortcutOptimizer::verify, this, verifiers[i], i, verifiers.size(), ::std::ref(candidates), ::std::ref(exceptions[i])));
+					}
+					
+					for (::std::size_t i = 0; i < threads.size(); ++i)
+					{
+						threads[i].join();
+					}
+					
+					threads.clear();
+				}
+				else
+				{
+					this->verify(verifiers[0], 0, 1, candidates, exceptions[0]);
+				}
+				
+				for (::std::size_t i = 0; i < exceptions.size(); ++i)
+				{
+					if (nullptr != exceptions[i])
+					{
+						::std::rethrow_exception(exceptions[i]);
+					}
+				}
+				
+				// apply largest gains first on disjoint path segments
+				
+				::std::vector<::std::pair<::rl::math::Real, ::std::size_t>> gains;
+				
+				for (::std::size_t i = 0; i < candidates.size(); ++i)
+				{
+					if (!candidates[i].colliding)
+					{
+						gains.push_back(::std::make_pair(candidates[i].gain, i));
+					}
+				}
+				
+				if (gains.empty())
+				{
+					continue;
+				}
+				
+				::std::sort(gains.rbegin(), gains.rend());
+				
+				::std::vector<bool> used(waypoints.size(), false);
+				::std::vector<::std::size_t> shortcuts(waypoints.size(), candidates.size());
+				
+				for (::std::size_t i = 0; i < gains.size(); ++i)
+				{
+					const Candidate& candidate = candidates[gains[i].second];
+					
+					if (::std::find(used.begin() + candidate.i, used.begin() + candidate.j + 1, true) == used.begin() + candidate.j + 1)
+					{
+						::std::fill(used.begin() + candidate.i, used.begin() + candidate.j + 1, true);
+						shortcuts[candidate.i] = gains[i].second;
+					}
+				}
+				
+				::std::vector<::rl::math::Vector> shortened;
+				shortened.reserve(waypoints.size() + 2 * candidates.size());
+				
+				for (::std::size_t i = 0; i < waypoints.size();)
+				{
+					shortened.push_back(waypoints[i]);
+					
+					if (shortcuts[i] < candidates.size())
+					{
+						shortened.push_back(candidates[shortcuts[i]].q0);
+						shortened.push_back(candidates[shortcuts[i]].q1);
+						i = candidates[shortcuts[i]].j + 1;
+					}
+					else
+					{
+						++i;
+					}
+				}
+				
+				waypoints.swap(shortened);
+				
+				if (nullptr != this->getViewer())
+				{
+					path.assign(waypoints.begin(), waypoints.end());
+					this->getViewer()->drawConfigurationPath(path);
+				}
+			}
+			
+			path.assign(waypoints.begin(), waypoints.end());
+		}
+		
+		::std::uniform_real_distribution<::rl::math::Real>::result_type
+		ShortcutOptimizer::rand()
+		{
+			return this->randDistribution(this->randEngine);
+		}
+		
+		void
+		ShortcutOptimizer::seed(const ::std::mt19937::result_type& value)
+		{
+			this->randEngine.seed(value);
+		}
+		
+		void
+		ShortcutOptimizer::setBatch(const ::std::size_t& batch)
+		{
+			this->batch = batch;
+		}
+		
+		void
+		ShortcutOptimizer::setDuration(const ::std::chrono::steady_clock::duration& duration)
+		{
+			this->duration = duration;
+		}
+		
+		void
+		ShortcutOptimizer::verify(Verifier* verifier, const ::std::size_t& first, const ::std::size_t& stride, ::std::vector<Candidate>& candidates, ::std::exception_ptr& exception)
+		{
+			try
+			{
+				for (::std::size_t i = first; i < candidates.size(); i += stride)
+				{
+					candidates[i].colliding = verifier->isColliding(candidates[i].q0, candidates[i].q1, candidates[i].distance);
+				}
+			}
+			catch (...)
+			{
+				exception = ::std::current_exception();
+			}
+		}
+	}
+}
@@ -0,0 +1,124 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef RL_PLAN_SHORTCUTOPTIMIZER_H
+#define RL_PLAN_SHORTCUTOPTIMIZER_H
+
+#include <chrono>
+#include <exception>
+#include <random>
+#include <vector>
+
+#include "Optimizer.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		/**
+		 * Randomized shortcuts between arbitrary points of a path.
+		 *
+		 * Each round draws a batch of random pairs of points along the path,
+		 * which may lie within path segments, verifies the straight
+		 * connections between them, and replaces the largest non-overlapping
+		 * detours by their shortcuts, until the duration is exceeded.
+		 *
+		 * Roland Geraerts and Mark H. Overmars. Creating high-quality paths for
+		 * motion planning. The International Journal of Robotics Research,
+		 * 26(8):845-863, August 2007.
+		 *
+		 * http://dx.doi.org/10.1177/0278364907079280
+		 */
+		class RL_PLAN_EXPORT ShortcutOptimizer : public Optimizer
+		{
+		public:
+			ShortcutOptimizer();
+			
+			virtual ~ShortcutOptimizer();
+			
+			/**
+			 * Add worker for parallel verification.
+			 *
+			 * With additional workers, process() verifies the candidate shortcuts
+			 * of each round on one thread per worker, using the optimizer's own
+			 * verifier in the first thread. As collision checking is not
+			 * thread-safe, every worker needs its own verifier and model.
+			 */
+			void addWorker(Verifier* verifier);
+			
+			::std::size_t getBatch() const;
+			
+			::std::chrono::steady_clock::duration getDuration() const;
+			
+			::std::size_t getWorkers() const;
+			
+			void process(VectorList& path);
+			
+			void seed(const ::std::mt19937::result_type& value);
+			
+			void setBatch(const ::std::size_t& batch);
+			
+			void setDuration(const ::std::chrono::steady_clock::duration& duration);
+			
+			/** Number of candidate shortcuts per round and thread. */
+			::std::size_t batch;
+			
+			::std::chrono::steady_clock::duration duration;
+			
+		protected:
+			
+		private:
+			struct Candidate
+			{
+				bool colliding;
+				
+				::rl::math::Real distance;
+				
+				::rl::math::Real gain;
+				
+				::std::size_t i;
+				
+				::std::size_t j;
+				
+				::rl::math::Vector q0;
+				
+				::rl::math::Vector q1;
+			};
+			
+			::std::uniform_real_distribution<::rl::math::Real>::result_type rand();
+			
+			void verify(Verifier* verifier, const ::std::size_t& first, const ::std::size_t& stride, ::std::vector<Candidate>& candidates, ::std::exception_ptr& exception);
+			
+			::std::uniform_real_distribution<::rl::math::Real> randDistribution;
+			
+			::std::mt19937 randEngine;
+			
+			::std::vector<Verifier*> workers;
+		};
+	}
+}
+
+#endif // RL_PLAN_SHORTCUTOPTIMIZER_H
@@ -24,6 +24,8 @@
 // POSSIBILITY OF SUCH DAMAGE.
 //
 
+#include <algorithm>
+#include <limits>
 #include <rl/sg/Body.h>
 #include <rl/sg/SimpleScene.h>
 
@@ -37,7 +39,17 @@ namespace rl
 			Model(),
 			body(0),
 			freeQueries(0),
-			totalQueries(0)
+			pairQueries(0),
+			sphereTreeHits(0),
+			totalQueries(0),
+			bodies(),
+			max(),
+			min(),
+			order(),
+			pairs(),
+			sphereTreeLeafSize(0),
+			sphereTreeRevision(0),
+			sphereTrees()
 		{
 		}
 		
@@ -57,6 +69,38 @@ namespace rl
 			return this->freeQueries;
 		}
 		
+		::std::size_t
+		SimpleModel::getPairQueries() const
+		{
+			return this->pairQueries;
+		}
+		
+		const SphereTree&
+		SimpleModel::getSphereTree(::rl::sg::Body* body)
+		{
+			::std::unordered_map<const ::rl::sg::Body*, SphereTree>::iterator i = this->sphereTrees.find(body);
+			
+			if (this->sphereTrees.end() == i)
+			{
+				i = this->sphereTrees.insert(::std::make_pair(body, SphereTree())).first;
+				i->second.build(body->points, this->sphereTreeLeafSize);
+			}
+			
+			return i->second;
+		}
+		
+		::std::size_t
+		SimpleModel::getSphereTreeHits() const
+		{
+			return this->sphereTreeHits;
+		}
+		
+		::std::size_t
+		SimpleModel::getSphereTreeLeafSize() const
+		{
+			return this->sphereTreeLeafSize;
+		}
+		
 		::std::size_t
 		SimpleModel::getTotalQueries() const
 		{
@@ -68,37 +112,113 @@ namespace rl
 		{
 			++this->totalQueries;
 			
-			for (::std::size_t i = 0; i < this->model->getNumBodies(); ++i)
+			this->updateBroadPhase();
+			
+			::std::size_t n = this->model->getNumBodies();
+			
+			// sweep and prune along x, bodies are sorted by their minimum
+			
+			this->pairs.clear();
+			
+			for (::std::size_t i = 0; i < this->order.size(); ++i)
 			{
-				if (this->isColliding(i))
+				::std::size_t a = this->order[i];
+				
+				for (::std::size_t j = i + 1; j < this->order.size() && this->min[this->order[j]].x() <= this->max[a].x(); ++j)
 				{
-					for (::rl::sg::Scene::Iterator j = this->scene->begin(); j != this->scene->end(); ++j)
+					::std::size_t b = this->order[j];
+					
+					if (a >= n && b >= n)
+					{
+						continue;
+					}
+					
+					if (
+						this->max[a].y() < this->min[b].y() || this->max[b].y() < this->min[a].y() ||
+						this->max[a].z() < this->min[b].z() || this->max[b].z() < this->min[a].z()
+					)
 					{
-						if (this->model != *j)
-						{
-							for (::rl::sg::Model::Iterator k = (*j)->begin(); k != (*j)->end(); ++k)
-							{
-								if (dynamic_cast<::rl::sg::SimpleScene*>(this->scene)->areColliding(this->model->getBody(i), *k))
-								{
-									this->body = i;
-									return true;
-								}
-							}
-						}
+						continue;
+					}
+					
+					// robot body first, other models before earlier robot bodies as in scene order
+					
+					if (a >= n)
+					{
+						this->pairs.push_back(::std::make_pair(b, a));
+					}
+					else if (b >= n)
+					{
+						this->pairs.push_back(::std::make_pair(a, b));
+					}
+					else
+					{
+						this->pairs.push_back(::std::make_pair(::std::max(a, b), this->bodies.size() + ::std::min(a, b)));
 					}
 				}
+			}
+			
+			::std::sort(this->pairs.begin(), this->pairs.end());
+			
+			::rl::sg::SimpleScene* scene = dynamic_cast<::rl::sg::SimpleScene*>(this->scene);
+			
+			for (::std::size_t i = 0; i < this->pairs.size(); ++i)
+			{
+				::std::size_t a = this->pairs[i].first;
+				::std::size_t b = this->pairs[i].second;
 				
-				for (::std::size_t j = 0; j < i; ++j)
+				if (b < this->bodies.size())
 				{
-					if (this->areColliding(i, j))
+					if (!this->isColliding(a))
 					{
-						if (dynamic_cast<::rl::sg::SimpleScene*>(this->scene)->areColliding(this->model->getBody(i), this->model->getBody(j)))
-						{
-							this->body = i;
-							return true;
-						}
+						continue;
 					}
 				}
+				else
+				{
+					b -= this->bodies.size();
+					
+					if (!this->areColliding(a, b))
+					{
+						continue;
+					}
+				}
+				
+				++this->pairQueries;
+				
+				if (this->sphereTreeLeafSize > 0)
+				{
+					if (this->scene->getRevision() != this->sphereTreeRevision)
+					{
+						// bodies may have been replaced at the same address or lost shapes
+						this->sphereTrees.clear();
+						this->sphereTreeRevision = this->scene->getRevision();
+					}
+					
+					SphereTree::Proximity proximity = this->getSphereTree(this->bodies[a]).classify(
+						this->getSphereTree(this->bodies[b]),
+						this->bodies[a]->getFrame(),
+						this->bodies[b]->getFrame()
+					);
+					
+					if (SphereTree::Proximity::free == proximity)
+					{
+						++this->sphereTreeHits;
+						continue;
+					}
+					else if (SphereTree::Proximity::colliding == proximity)
+					{
+						++this->sphereTreeHits;
+						this->body = a;
+						return true;
+					}
+				}
+				
+				if (scene->areColliding(this->bodies[a], this->bodies[b]))
+				{
+					this->body = a;
+					return true;
+				}
 			}
 			
 			this->body = this->getBodies();
@@ -119,7 +239,76 @@ namespace rl
 		{
 			this->body = 0;
 			this->freeQueries = 0;
+			this->pairQueries = 0;
+			this->sphereTreeHits = 0;
 			this->totalQueries = 0;
 		}
+		
+		void
+		SimpleModel::setSphereTreeLeafSize(const ::std::size_t& sphereTreeLeafSize)
+		{
+			this->sphereTreeLeafSize = sphereTreeLeafSize;
+			this->sphereTrees.clear();
+		}
+		
+		void
+		SimpleModel::updateBroadPhase()
+		{
+			this->bodies.assign(this->model->begin(), this->model->end());
+			
+			for (::rl::sg::Scene::Iterator i = this->scene->begin(); i != this->scene->end(); ++i)
+			{
+				if (this->model != *i)
+				{
+					this->bodies.insert(this->bodies.end(), (*i)->begin(), (*i)->end());
+				}
+			}
+			
+			this->max.resize(this->bodies.size());
+			this->min.resize(this->bodies.size());
+			
+			for (::std::size_t i = 0; i < this->bodies.size(); ++i)
+			{
+				if (this->bodies[i]->max.isZero() && this->bodies[i]->min.isZero())
+				{
+					// no bounding box loaded, never culled
+					this->max[i].setConstant(::std::numeric_limits<::rl::math::Real>::infinity());
+					this->min[i].setConstant(-::std::numeric_limits<::rl::math::Real>::infinity());
+				}
+				else
+				{
+					::rl::math::Transform frame = this->bodies[i]->getFrame();
+					::rl::math::Vector3 center = frame * (0.5 * (this->bodies[i]->max + this->bodies[i]->min));
+					::rl::math::Vector3 extent = frame.linear().cwiseAbs() * (0.5 * (this->bodies[i]->max - this->bodies[i]->min));
+					this->max[i] = center + extent;
+					this->min[i] = center - extent;
+				}
+			}
+			
+			if (this->order.size() != this->bodies.size())
+			{
+				this->order.resize(this->bodies.size());
+				
+				for (::std::size_t i = 0; i < this->order.size(); ++i)
+				{
+					this->order[i] = i;
+				}
+			}
+			
+			// insertion sort, frames change little between queries so the order is nearly sorted
+			
+			for (::std::size_t i = 1; i < this->order.size(); ++i)
+			{
+				::std::size_t a = this->order[i];
+				::std::size_t j = i;
+				
+				for (; j > 0 && this->min[this->order[j - 1]].x() > this->min[a].x(); --j)
+				{
+					this->order[j] = this->order[j - 1];
+				}
+				
+				this->order[j] = a;
+			}
+		}
 	}
 }
@@ -27,7 +27,12 @@
 #ifndef RL_PLAN_SIMPLEMODEL_H
 #define RL_PLAN_SIMPLEMODEL_H
 
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include "Model.h"
+#include "SphereTree.h"
 
 namespace rl
 {
@@ -44,6 +49,20 @@ namespace rl
 			
 			::std::size_t getFreeQueries() const;
 			
+			/**
+			 * Number of body pairs that passed the broad phase and the collision
+			 * filters of the kinematic model. Pairs with disjoint bounding boxes
+			 * are not counted. Bodies without bounding box are never culled.
+			 */
+			::std::size_t getPairQueries() const;
+			
+			/**
+			 * Number of body pairs decided by sphere trees without querying the scene.
+			 */
+			::std::size_t getSphereTreeHits() const;
+			
+			::std::size_t getSphereTreeLeafSize() const;
+			
 			::std::size_t getTotalQueries() const;
 			
 			using Model::isColliding;
@@ -54,15 +73,59 @@ namespace rl
 			
 			virtual void reset();
 			
+			/**
+			 * Enables sphere tree pre-checks of body pairs before querying the scene.
+			 *
+			 * Trees are built from rl::sg::Body::points on first use and rebuilt
+			 * after structural changes of the scene, so the scene needs to be
+			 * loaded with points. Pairs are only passed to the scene
+			 * if the trees cannot decide them. As the trees treat bodies as solids,
+			 * a body completely inside of another may be reported as colliding
+			 * with scenes that only test surfaces.
+			 *
+			 * @param[in] sphereTreeLeafSize Maximum number of triangles per leaf,
+			 * 0 disables pre-checks (default)
+			 */
+			void setSphereTreeLeafSize(const ::std::size_t& sphereTreeLeafSize);
+			
 		protected:
 			::std::size_t body;
 			
 			::std::size_t freeQueries;
 			
+			::std::size_t pairQueries;
+			
+			::std::size_t sphereTreeHits;
+			
 			::std::size_t totalQueries;
 			
 		private:
+			const SphereTree& getSphereTree(::rl::sg::Body* body);
+			
+			void updateBroadPhase();
+			
+			/** All bodies of the scene, starting with the bodies of the robot. */
+			::std::vector<::rl::sg::Body*> bodies;
+			
+			/** World-space bounding box maxima per body. */
+			::std::vector<::rl::math::Vector3> max;
+			
+			/** World-space bounding box minima per body. */
+			::std::vector<::rl::math::Vector3> min;
+			
+			/** Body indices sorted by bounding box minimum along x, kept between queries. */
+			::std::vector<::std::size_t> order;
+			
+			/** Overlapping pairs (robot body, other body) found by the sweep. */
+			::std::vector<::std::pair<::std::size_t, ::std::size_t>> pairs;
+			
+			::std::size_t sphereTreeLeafSize;
+			
+			/** Scene revision the sphere trees were built for. */
+			::std::size_t sphereTreeRevision;
 			
+			/** Sphere trees per body, built on first use and cleared on changes of the scene. */
+			::std::unordered_map<const ::rl::sg::Body*, SphereTree> sphereTrees;
 		};
 	}
 }
@@ -0,0 +1,491 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "SphereTree.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		SphereTree::SphereTree() :
+			inner(),
+			max(::rl::math::Vector3::Zero()),
+			min(::rl::math::Vector3::Zero()),
+			nodes(),
+			vertices()
+		{
+			this->inner.center.setZero();
+			this->inner.radius = 0;
+		}
+		
+		SphereTree::~SphereTree()
+		{
+		}
+		
+		void
+		SphereTree::build(const ::std::vector<::rl::math::Vector3>& points, const ::std::size_t& leafSize)
+		{
+			this->clear();
+			
+			::std::vector<::std::size_t> triangles(points.size() / 3);
+			
+			if (triangles.empty())
+			{
+				return;
+			}
+			
+			for (::std::size_t i = 0; i < triangles.size(); ++i)
+			{
+				triangles[i] = i;
+			}
+			
+			this->build(points, triangles, 0, triangles.size(), ::std::max(leafSize, static_cast<::std::size_t>(1)));
+			
+			this->vertices.resize(3 * triangles.size());
+			
+			for (::std::size_t i = 0; i < triangles.size(); ++i)
+			{
+				for (::std::size_t j = 0; j < 3; ++j)
+				{
+					this->vertices[3 * i + j] = points[3 * triangles[i] + j];
+				}
+			}
+			
+			this->max = this->vertices[0];
+			this->min = this->vertices[0];
+			
+			for (::std::size_t i = 1; i < this->vertices.size(); ++i)
+			{
+				this->max = this->max.cwiseMax(this->vertices[i]);
+				this->min = this->min.cwiseMin(this->vertices[i]);
+			}
+			
+			// inner sphere at the vertex mean or the box center, whichever is inside with larger clearance
+			
+			::rl::math::Vector3 candidates[2] = {::rl::math::Vector3::Zero(), (this->min + this->max) / 2};
+			
+			for (::std::size_t i = 0; i < this->vertices.size(); ++i)
+			{
+				candidates[0] += this->vertices[i] / static_cast<::rl::math::Real>(this->vertices.size());
+			}
+			
+			for (::std::size_t i = 0; i < 2; ++i)
+			{
+				if (!this->isInside(candidates[i], 6))
+				{
+					continue;
+				}
+				
+				::rl::math::Real radius = ::std::numeric_limits<::rl::math::Real>::max();
+				
+				for (::std::size_t j = 0; j < this->vertices.size(); j += 3)
+				{
+					radius = ::std::min(radius, (candidates[i] - SphereTree::closestPoint(candidates[i], this->vertices[j], this->vertices[j + 1], this->vertices[j + 2])).norm());
+				}
+				
+				if (radius > this->inner.radius)
+				{
+					this->inner.center = candidates[i];
+					this->inner.radius = radius;
+				}
+			}
+		}
+		
+		::std::size_t
+		SphereTree::build(const ::std::vector<::rl::math::Vector3>& points, ::std::vector<::std::size_t>& triangles, const ::std::size_t& first, const ::std::size_t& last, const ::std::size_t& leafSize)
+		{
+			::std::size_t index = this->nodes.size();
+			this->nodes.push_back(Node());
+			
+			::rl::math::Vector3 minimum = points[3 * triangles[first]];
+			::rl::math::Vector3 maximum = minimum;
+			::rl::math::Vector3 centroidMinimum = ::rl::math::Vector3::Constant(::std::numeric_limits<::rl::math::Real>::max());
+			::rl::math::Vector3 centroidMaximum = ::rl::math::Vector3::Constant(-::std::numeric_limits<::rl::math::Real>::max());
+			
+			for (::std::size_t i = first; i < last; ++i)
+			{
+				::rl::math::Vector3 centroid = ::rl::math::Vector3::Zero();
+				
+				for (::std::size_t j = 0; j < 3; ++j)
+				{
+					minimum = minimum.cwiseMin(points[3 * triangles[i] + j]);
+					maximum = maximum.cwiseMax(points[3 * triangles[i] + j]);
+					centroid += points[3 * triangles[i] + j];
+				}
+				
+				centroidMinimum = centroidMinimum.cwiseMin(centroid);
+				centroidMaximum = centroidMaximum.cwiseMax(centroid);
+			}
+			
+			Sphere sphere;
+			sphere.center = (minimum + maximum) / 2;
+			sphere.radius = 0;
+			
+			for (::std::size_t i = first; i < last; ++i)
+			{
+				for (::std::size_t j = 0; j < 3; ++j)
+				{
+					sphere.radius = ::std::max(sphere.radius, (points[3 * triangles[i] + j] - sphere.center).norm());
+				}
+			}
+			
+			this->nodes[index].children[0] = 0;
+			this->nodes[index].children[1] = 0;
+			this->nodes[index].first = first;
+			this->nodes[index].last = last;
+			this->nodes[index].sphere = sphere;
+			
+			if (last - first <= leafSize)
+			{
+				return index;
+			}
+			
+			// split at the median triangle centroid along the axis of largest extent
+			
+			Compare compare;
+			(centroidMaximum - centroidMinimum).maxCoeff(&compare.axis);
+			compare.points = &points;
+			
+			::std::size_t middle = first + (last - first) / 2;
+			::std::nth_element(triangles.begin() + first, triangles.begin() + middle, triangles.begin() + last, compare);
+			
+			::std::size_t left = this->build(points, triangles, first, middle, leafSize);
+			::std::size_t right = this->build(points, triangles, middle, last, leafSize);
+			
+			this->nodes[index].children[0] = left;
+			this->nodes[index].children[1] = right;
+			
+			return index;
+		}
+		
+		SphereTree::Proximity
+		SphereTree::classify(const SphereTree& other, const ::rl::math::Transform& frame, const ::rl::math::Transform& otherFrame) const
+		{
+			if (this->nodes.empty() || other.nodes.empty())
+			{
+				return Proximity::unknown;
+			}
+			
+			if (this->inner.radius > 0 && other.inner.radius > 0)
+			{
+				::rl::math::Real radius = this->inner.radius + other.inner.radius;
+				
+				if ((frame * this->inner.center - otherFrame * other.inner.center).squaredNorm() < radius * radius)
+				{
+					return Proximity::colliding;
+				}
+			}
+			
+			// traverse in coordinates of the other body, descending into the larger sphere
+			
+			::rl::math::Transform relative = otherFrame.inverse(::Eigen::Isometry) * frame;
+			
+			::std::vector<::std::pair<::std::size_t, ::std::size_t>> stack;
+			stack.push_back(::std::make_pair(0, 0));
+			
+			while (!stack.empty())
+			{
+				const Node& node1 = this->nodes[stack.back().first];
+				const Node& node2 = other.nodes[stack.back().second];
+				::std::size_t index1 = stack.back().first;
+				::std::size_t index2 = stack.back().second;
+				stack.pop_back();
+				
+				::rl::math::Real radius = node1.sphere.radius + node2.sphere.radius;
+				
+				if ((relative * node1.sphere.center - node2.sphere.center).squaredNorm() > radius * radius)
+				{
+					continue;
+				}
+				
+				bool leaf1 = 0 == node1.children[0];
+				bool leaf2 = 0 == node2.children[0];
+				
+				if (leaf1 && leaf2)
+				{
+					return Proximity::unknown;
+				}
+				
+				if (leaf2 || (!leaf1 && node1.sphere.radius >= node2.sphere.radius))
+				{
+					stack.push_back(::std::make_pair(node1.children[0], index2));
+					stack.push_back(::std::make_pair(node1.children[1], index2));
+				}
+				else
+				{
+					stack.push_back(::std::make_pair(index1, node2.children[0]));
+					stack.push_back(::std::make_pair(index1, node2.children[1]));
+				}
+			}
+			
+			// surfaces are disjoint, so the bodies are either separated or one lies completely inside of the other
+			
+			::rl::math::Vector3 point = relative * this->vertices.front();
+			
+			if (other.contains(point) && other.isInside(point))
+			{
+				return Proximity::unknown;
+			}
+			
+			point = relative.inverse(::Eigen::Isometry) * other.vertices.front();
+			
+			if (this->contains(point) && this->isInside(point))
+			{
+				return Proximity::unknown;
+			}
+			
+			return Proximity::free;
+		}
+		
+		void
+		SphereTree::clear()
+		{
+			this->inner.center.setZero();
+			this->inner.radius = 0;
+			this->max.setZero();
+			this->min.setZero();
+			this->nodes.clear();
+			this->vertices.clear();
+		}
+		
+		::rl::math::Vector3
+		SphereTree::closestPoint(const ::rl::math::Vector3& point, const ::rl::math::Vector3& a, const ::rl::math::Vector3& b, const ::rl::math::Vector3& c)
+		{
+			::rl::math::Vector3 ab = b - a;
+			::rl::math::Vector3 ac = c - a;
+			::rl::math::Vector3 ap = point - a;
+			
+			::rl::math::Real d1 = ab.dot(ap);
+			::rl::math::Real d2 = ac.dot(ap);
+			
+			if (d1 <= 0 && d2 <= 0)
+			{
+				return a;
+			}
+			
+			::rl::math::Vector3 bp = point - b;
+			::rl::math::Real d3 = ab.dot(bp);
+			::rl::math::Real d4 = ac.dot(bp);
+			
+			if (d3 >= 0 && d4 <= d3)
+			{
+				return b;
+			}
+			
+			::rl::math::Real vc = d1 * d4 - d3 * d2;
+			
+			if (vc <= 0 && d1 >= 0 && d3 <= 0)
+			{
+				return a + d1 / (d1 - d3) * ab;
+			}
+			
+			::rl::math::Vector3 cp = point - c;
+			::rl::math::Real d5 = ab.dot(cp);
+			::rl::math::Real d6 = ac.dot(cp);
+			
+			if (d6 >= 0 && d5 <= d6)
+			{
+				return c;
+			}
+			
+			::rl::math::Real vb = d5 * d2 - d1 * d6;
+			
+			if (vb <= 0 && d2 >= 0 && d6 <= 0)
+			{
+				return a + d2 / (d2 - d6) * ac;
+			}
+			
+			::rl::math::Real va = d3 * d6 - d5 * d4;
+			
+			if (va <= 0 && d4 - d3 >= 0 && d5 - d6 >= 0)
+			{
+				return b + (d4 - d3) / ((d4 - d3) + (d5 - d6)) * (c - b);
+			}
+			
+			::rl::math::Real denominator = va + vb + vc;
+			
+			if (denominator <= 0)
+			{
+				return a;
+			}
+			
+			return a + vb / denominator * ab + vc / denominator * ac;
+		}
+		
+		bool
+		SphereTree::Compare::operator()(const ::std::size_t& lhs, const ::std::size_t& rhs) const
+		{
+			return
+				(*this->points)[3 * lhs](this->axis) + (*this->points)[3 * lhs + 1](this->axis) + (*this->points)[3 * lhs + 2](this->axis) <
+				(*this->points)[3 * rhs](this->axis) + (*this->points)[3 * rhs + 1](this->axis) + (*this->points)[3 * rhs + 2](this->axis);
+		}
+		
+		bool
+		SphereTree::contains(const ::rl::math::Vector3& point) const
+		{
+			return (point.array() >= this->min.array()).all() && (point.array() <= this->max.array()).all();
+		}
+		
+		::std::size_t
+		SphereTree::crossings(const ::rl::math::Vector3& origin, const ::rl::math::Vector3& direction) const
+		{
+			::std::size_t crossings = 0;
+			
+			::std::vector<::std::size_t> stack;
+			stack.push_back(0);
+			
+			while (!stack.empty())
+			{
+				const Node& node = this->nodes[stack.back()];
+				stack.pop_back();
+				
+				// skip spheres that do not intersect the ray
+				
+				::rl::math::Vector3 w = node.sphere.center - origin;
+				::rl::math::Real t = ::std::max(w.dot(direction), static_cast<::rl::math::Real>(0));
+				
+				if ((w - t * direction).squaredNorm() > node.sphere.radius * node.sphere.radius)
+				{
+					continue;
+				}
+				
+				if (0 != node.children[0])
+				{
+					stack.push_back(node.children[0]);
+					stack.push_back(node.children[1]);
+					continue;
+				}
+				
+				for (::std::size_t i = 3 * node.first; i < 3 * node.last; i += 3)
+				{
+					::rl::math::Vector3 edge1 = this->vertices[i + 1] - this->vertices[i];
+					::rl::math::Vector3 edge2 = this->vertices[i + 2] - this->vertices[i];
+					::rl::math::Vector3 p = direction.cross(edge2);
+					::rl::math::Real determinant = edge1.dot(p);
+					
+					if (0 == determinant)
+					{
+						continue;
+					}
+					
+					::rl::math::Vector3 s = origin - this->vertices[i];
+					::rl::math::Real u = s.dot(p) / determinant;
+					
+					if (u < 0 || u > 1)
+					{
+						continue;
+					}
+					
+					::rl::math::Vector3 q = s.cross(edge1);
+					::rl::math::Real v = direction.dot(q) / determinant;
+					
+					if (v < 0 || u + v > 1)
+					{
+						continue;
+					}
+					
+					if (edge2.dot(q) / determinant > 0)
+					{
+						++crossings;
+					}
+				}
+			}
+			
+			return crossings;
+		}
+		
+		bool
+		SphereTree::empty() const
+		{
+			return this->nodes.empty();
+		}
+		
+		const SphereTree::Sphere&
+		SphereTree::getInner() const
+		{
+			return this->inner;
+		}
+		
+		::std::size_t
+		SphereTree::getNumLeaves() const
+		{
+			::std::size_t leaves = 0;
+			
+			for (::std::size_t i = 0; i < this->nodes.size(); ++i)
+			{
+				if (0 == this->nodes[i].children[0])
+				{
+					++leaves;
+				}
+			}
+			
+			return leaves;
+		}
+		
+		::std::size_t
+		SphereTree::getNumNodes() const
+		{
+			return this->nodes.size();
+		}
+		
+		const SphereTree::Sphere&
+		SphereTree::getRoot() const
+		{
+			return this->nodes.front().sphere;
+		}
+		
+		bool
+		SphereTree::isInside(const ::rl::math::Vector3& point, const ::std::size_t& rays) const
+		{
+			if (this->nodes.empty())
+			{
+				return false;
+			}
+			
+			// skewed axes avoid hitting shared edges of axis-aligned meshes
+			
+			for (::std::size_t i = 0; i < ::std::min(rays, static_cast<::std::size_t>(6)); ++i)
+			{
+				::rl::math::Vector3 direction;
+				direction(i % 3) = i < 3 ? 1 : -1;
+				direction((i + 1) % 3) = static_cast<::rl::math::Real>(1.4142135623730951e-3);
+				direction((i + 2) % 3) = static_cast<::rl::math::Real>(1.7320508075688772e-3);
+				direction.normalize();
+				
+				if (0 == this->crossings(point, direction) % 2)
+				{
+					return false;
+				}
+			}
+			
+			return true;
+		}
+	}
+}
@@ -0,0 +1,157 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef RL_PLAN_SPHERETREE_H
+#define RL_PLAN_SPHERETREE_H
+
+#include <vector>
+#include <rl/math/Transform.h>
+#include <rl/math/Vector.h>
+#include <rl/plan/export.h>
+
+namespace rl
+{
+	namespace plan
+	{
+		/**
+		 * Hierarchy of bounding spheres over the triangles of a body.
+		 *
+		 * Every node encloses all vertices of its triangles, so the leaves
+		 * cover the whole surface. Closed meshes additionally get an inner
+		 * sphere that lies completely inside of the solid, and the tree
+		 * accelerates ray parity tests for points inside of the solid. Two trees allow
+		 * deciding clearly free and clearly colliding configurations of two
+		 * bodies before running an exact check, both treating bodies as solids.
+		 */
+		class RL_PLAN_EXPORT SphereTree
+		{
+		public:
+			enum class Proximity
+			{
+				colliding,
+				free,
+				unknown
+			};
+			
+			struct Sphere
+			{
+				::rl::math::Vector3 center;
+				
+				::rl::math::Real radius;
+			};
+			
+			SphereTree();
+			
+			virtual ~SphereTree();
+			
+			/**
+			 * @param[in] points Triangle vertices in body coordinates, three
+			 * consecutive entries per triangle, e.g., from rl::sg::Body::points
+			 * @param[in] leafSize Maximum number of triangles per leaf
+			 */
+			void build(const ::std::vector<::rl::math::Vector3>& points, const ::std::size_t& leafSize);
+			
+			/**
+			 * @param[in] frame World frame of this body
+			 * @param[in] otherFrame World frame of the other body
+			 * @return colliding if the inner spheres intersect, free if no
+			 * leaves intersect and neither body can contain the other, and
+			 * unknown otherwise or if a tree is empty
+			 */
+			Proximity classify(const SphereTree& other, const ::rl::math::Transform& frame, const ::rl::math::Transform& otherFrame) const;
+			
+			void clear();
+			
+			bool empty() const;
+			
+			/**
+			 * Tests parity of triangle crossings along skewed rays, requires closed meshes.
+			 *
+			 * @param[in] point Point in body coordinates
+			 * @param[in] rays Number of rays that all need an odd number of crossings, up to six
+			 */
+			bool isInside(const ::rl::math::Vector3& point, const ::std::size_t& rays = 1) const;
+			
+			/**
+			 * @return Sphere inside of the solid, with zero radius if none was found
+			 */
+			const Sphere& getInner() const;
+			
+			::std::size_t getNumLeaves() const;
+			
+			::std::size_t getNumNodes() const;
+			
+			const Sphere& getRoot() const;
+			
+		protected:
+			
+		private:
+			struct Compare
+			{
+				bool operator()(const ::std::size_t& lhs, const ::std::size_t& rhs) const;
+				
+				::std::size_t axis;
+				
+				const ::std::vector<::rl::math::Vector3>* points;
+			};
+			
+			struct Node
+			{
+				::std::size_t children[2];
+				
+				::std::size_t first;
+				
+				::std::size_t last;
+				
+				Sphere sphere;
+			};
+			
+			::std::size_t build(const ::std::vector<::rl::math::Vector3>& points, ::std::vector<::std::size_t>& triangles, const ::std::size_t& first, const ::std::size_t& last, const ::std::size_t& leafSize);
+			
+			static ::rl::math::Vector3 closestPoint(const ::rl::math::Vector3& point, const ::rl::math::Vector3& a, const ::rl::math::Vector3& b, const ::rl::math::Vector3& c);
+			
+			bool contains(const ::rl::math::Vector3& point) const;
+			
+			::std::size_t crossings(const ::rl::math::Vector3& origin, const ::rl::math::Vector3& direction) const;
+			
+			Sphere inner;
+			
+			/** Maximum of axis-aligned bounding box in body coordinates. */
+			::rl::math::Vector3 max;
+			
+			/** Minimum of axis-aligned bounding box in body coordinates. */
+			::rl::math::Vector3 min;
+			
+			/** Nodes in depth-first order, starting with the root. */
+			::std::vector<Node> nodes;
+			
+			/** Triangle vertices ordered by leaves, three consecutive entries per triangle. */
+			::std::vector<::rl::math::Vector3> vertices;
+		};
+	}
+}
+
+#endif // RL_PLAN_SPHERETREE_H
@@ -0,0 +1,415 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <rl/mdl/Dynamic.h>
+
+#include "Exception.h"
+#include "Topp.h"
+
+namespace rl
+{
+	namespace plan
+	{
+		Topp::Topp() :
+			acceleration(),
+			blend(static_cast<::rl::math::Real>(0.2)),
+			model(nullptr),
+			steps(1000),
+			torque()
+		{
+		}
+		
+		Topp::~Topp()
+		{
+		}
+		
+		void
+		Topp::constrain(const ::std::vector<::rl::math::Vector>& q, const ::rl::math::Vector& speed, ::rl::mdl::Dynamic* dynamic, ::rl::math::Matrix& constraints) const
+		{
+			::std::size_t dof = q[0].size();
+			
+			constraints.resize(2 + 2 * dof + (this->torque.size() > 0 ? 2 * dof : 0), 3);
+			
+			::rl::math::Real x = ::std::numeric_limits<::rl::math::Real>::max();
+			
+			for (::std::size_t i = 0; i < dof; ++i)
+			{
+				if (::std::abs(q[1](i)) > ::std::numeric_limits<::rl::math::Real>::epsilon())
+				{
+					x = ::std::min(x, ::std::pow(speed(i) / q[1](i), 2));
+				}
+			}
+			
+			constraints.row(0) << 0, -1, 0;
+			
+			if (x < ::std::numeric_limits<::rl::math::Real>::max())
+			{
+				constraints.row(1) << 0, 1, x;
+			}
+			else
+			{
+				constraints.row(1) << 0, -1, 0;
+			}
+			
+			constraints.block(2, 0, dof, 1) = q[1];
+			constraints.block(2, 1, dof, 1) = q[2];
+			constraints.block(2, 2, dof, 1) = this->acceleration;
+			constraints.block(2 + dof, 0, dof, 1) = -q[1];
+			constraints.block(2 + dof, 1, dof, 1) = -q[2];
+			constraints.block(2 + dof, 2, dof, 1) = this->acceleration;
+			
+			if (this->torque.size() > 0)
+			{
+				// tau = M(q) * q' * u + (M(q) * q'' + C(q, q') * q') * x + g(q)
+				
+				dynamic->setPosition(q[0]);
+				dynamic->setVelocity(::rl::math::Vector::Zero(dof));
+				dynamic->setAcceleration(::rl::math::Vector::Zero(dof));
+				dynamic->inverseDynamics();
+				::rl::math::Vector g = dynamic->getTorque();
+				
+				dynamic->setAcceleration(q[1]);
+				dynamic->inverseDynamics();
+				::rl::math::Vector a = dynamic->getTorque() - g;
+				
+				dynamic->setVelocity(q[1]);
+				dynamic->setAcceleration(q[2]);
+				dynamic->inverseDynamics();
+				::rl::math::Vector b = dynamic->getTorque() - g;
+				
+				constraints.block(2 + 2 * dof, 0, dof, 1) = a;
+				constraints.block(2 + 2 * dof, 1, dof, 1) = b;
+				constraints.block(2 + 2 * dof, 2, dof, 1) = this->torque - g;
+				constraints.block(2 + 3 * dof, 0, dof, 1) = -a;
+				constraints.block(2 + 3 * dof, 1, dof, 1) = -b;
+				constraints.block(2 + 3 * dof, 2, dof, 1) = this->torque + g;
+			}
+		}
+		
+		bool
+		Topp::controllable(const ::rl::math::Matrix& constraints, const ::rl::math::Real& delta, const ::rl::math::Real& min, const ::rl::math::Real& max, ::rl::math::Real& lower, ::rl::math::Real& upper) const
+		{
+			// half-planes a * u + b * x <= c in path acceleration u and path velocity squared x,
+			// including x + 2 * delta * u within [min, max] of next grid point
+			
+			::rl::math::Matrix halfplanes(constraints.rows() + 2, 3);
+			halfplanes.topRows(constraints.rows()) = constraints;
+			halfplanes.row(constraints.rows()) << 2 * delta, 1, max;
+			halfplanes.row(constraints.rows() + 1) << -2 * delta, -1, -min;
+			
+			::rl::math::Real epsilon = static_cast<::rl::math::Real>(1.0e-9);
+			bool feasible = false;
+			
+			for (::std::ptrdiff_t i = 0; i < halfplanes.rows(); ++i)
+			{
+				for (::std::ptrdiff_t j = i + 1; j < halfplanes.rows(); ++j)
+				{
+					::rl::math::Real det = halfplanes(i, 0) * halfplanes(j, 1) - halfplanes(j, 0) * halfplanes(i, 1);
+					
+					if (::std::abs(det) <= ::std::numeric_limits<::rl::math::Real>::epsilon())
+					{
+						continue;
+					}
+					
+					::rl::math::Real u = (halfplanes(i, 2) * halfplanes(j, 1) - halfplanes(j, 2) * halfplanes(i, 1)) / det;
+					::rl::math::Real x = (halfplanes(i, 0) * halfplanes(j, 2) - halfplanes(j, 0) * halfplanes(i, 2)) / det;
+					
+					bool vertex = true;
+					
+					for (::std::ptrdiff_t k = 0; k < halfplanes.rows() && vertex; ++k)
+					{
+						vertex = halfplanes(k, 0) * u + halfplanes(k, 1) * x <= halfplanes(k, 2) + epsilon * (1 + ::std::abs(halfplanes(k, 2)));
+					}
+					
+					if (vertex)
+					{
+						lower = feasible ? ::std::min(lower, x) : x;
+						upper = feasible ? ::std::max(upper, x) : x;
+						feasible = true;
+					}
+				}
+			}
+			
+			if (feasible)
+			{
+				lower = ::std::max(lower, static_cast<::rl::math::Real>(0));
+				upper = ::std::max(upper, lower);
+			}
+			
+			return feasible;
+		}
+		
+		::rl::mdl::Model*
+		Topp::getModel() const
+		{
+			return this->model;
+		}
+		
+		::rl::math::Spline<::rl::math::Vector>
+		Topp::process(const VectorList& path) const
+		{
+			::std::vector<::rl::math::Vector> waypoints;
+			::std::vector<::rl::math::Real> lengths;
+			::rl::math::Real shortest = ::std::numeric_limits<::rl::math::Real>::max();
+			
+			for (VectorList::const_iterator i = path.begin(); i != path.end(); ++i)
+			{
+				if (waypoints.empty())
+				{
+					waypoints.push_back(*i);
+					lengths.push_back(0);
+				}
+				else
+				{
+					::rl::math::Real length = (*i - waypoints.back()).norm();
+					
+					if (length > ::std::numeric_limits<::rl::math::Real>::epsilon())
+					{
+						waypoints.push_back(*i);
+						lengths.push_back(lengths.back() + length);
+						shortest = ::std::min(shortest, length);
+					}
+				}
+			}
+			
+			if (waypoints.size() < 2)
+			{
+				return ::rl::math::Spline<::rl::math::Vector>();
+			}
+			
+			::std::size_t dof = this->model->getDofPosition();
+			
+			if (this->model->getSpeed().size() != dof)
+			{
+				throw Exception("rl::plan::Topp::process() - Speed limits do not match degrees of freedom");
+			}
+			
+			if (this->acceleration.size() != dof)
+			{
+				throw Exception("rl::plan::Topp::process() - Acceleration limits do not match degrees of freedom");
+			}
+			
+			if (this->torque.size() > 0 && this->torque.size() != dof)
+			{
+				throw Exception("rl::plan::Topp::process() - Torque limits do not match degrees of freedom");
+			}
+			
+			if (waypoints.front().size() != dof)
+			{
+				throw Exception("rl::plan::Topp::process() - Path does not match degrees of freedom");
+			}
+			
+			::rl::mdl::Dynamic* dynamic = dynamic_cast<::rl::mdl::Dynamic*>(this->model);
+			
+			if (this->torque.size() > 0 && nullptr == dynamic)
+			{
+				throw Exception("rl::plan::Topp::process() - Torque limits require rl::mdl::Dynamic");
+			}
+			
+			::rl::math::Spline<::rl::math::Vector> geometric = ::rl::math::Spline<::rl::math::Vector>::LinearParabolic(lengths, waypoints, this->blend * shortest);
+			
+			// uniform grid including the breakpoints of the geometric path,
+			// so that each grid interval lies within one polynomial
+			
+			::std::vector<::rl::math::Real> s;
+			::std::vector<::std::size_t> segments;
+			::rl::math::Real begin = geometric.lower();
+			
+			for (::std::size_t i = 0; i < geometric.size(); ++i)
+			{
+				::rl::math::Real end = begin + geometric[i].duration();
+				::std::size_t first = static_cast<::std::size_t>(::std::ceil((begin - geometric.lower()) / geometric.duration() * this->steps));
+				::std::size_t last = static_cast<::std::size_t>(::std::floor((end - geometric.lower()) / geometric.duration() * this->steps));
+				
+				s.push_back(begin);
+				segments.push_back(i);
+				
+				for (::std::size_t j = first; j <= last && j < this->steps; ++j)
+				{
+					::rl::math::Real x = geometric.lower() + geometric.duration() * j / this->steps;
+					
+					if (x - s.back() > ::std::numeric_limits<::rl::math::Real>::epsilon() * geometric.duration() && end - x > ::std::numeric_limits<::rl::math::Real>::epsilon() * geometric.duration())
+					{
+						s.push_back(x);
+						segments.push_back(i);
+					}
+				}
+				
+				begin = end;
+			}
+			
+			s.push_back(geometric.upper());
+			
+			::std::vector<::rl::math::Real> starts(geometric.size(), geometric.lower());
+			
+			for (::std::size_t i = 1; i < geometric.size(); ++i)
+			{
+				starts[i] = starts[i - 1] + geometric[i - 1].duration();
+			}
+			
+			// constraints a * u + b * x <= c on path acceleration u and path velocity squared x
+			// at both ends of each grid interval, with first-order interpolation x + 2 * delta * u
+			// at the end, so that joint accelerations are linear in s within each interval
+			
+			::rl::math::Vector speed = this->model->getSpeed();
+			::std::vector<::rl::math::Matrix> constraints(segments.size());
+			::std::vector<::rl::math::Vector> q(3);
+			
+			for (::std::size_t i = 0; i < segments.size(); ++i)
+			{
+				::rl::math::Real delta = s[i + 1] - s[i];
+				::rl::math::Matrix end;
+				
+				geometric[segments[i]](s[i] - starts[segments[i]], q);
+				this->constrain(q, speed, dynamic, constraints[i]);
+				geometric[segments[i]](s[i + 1] - starts[segments[i]], q);
+				this->constrain(q, speed, dynamic, end);
+				
+				end.col(0) += 2 * delta * end.col(1);
+				::std::ptrdiff_t rows = constraints[i].rows();
+				constraints[i].conservativeResize(rows + end.rows(), ::Eigen::NoChange);
+				constraints[i].bottomRows(end.rows()) = end;
+			}
+			
+			// backward pass over controllable sets of path velocity squared
+			
+			::std::vector<::rl::math::Real> lower(s.size(), 0);
+			::std::vector<::rl::math::Real> upper(s.size(), 0);
+			
+			for (::std::size_t i = segments.size(); i > 0; --i)
+			{
+				if (!this->controllable(constraints[i - 1], s[i] - s[i - 1], lower[i], upper[i], lower[i - 1], upper[i - 1]))
+				{
+					if (this->torque.size() > 0)
+					{
+						throw Exception("rl::plan::Topp::process() - Torque limits exceeded along path");
+					}
+					else
+					{
+						throw Exception("rl::plan::Topp::process() - Speed and acceleration limits not satisfiable along path");
+					}
+				}
+			}
+			
+			if (lower[0] > 0)
+			{
+				throw Exception("rl::plan::Topp::process() - Torque limits exceeded at rest");
+			}
+			
+			// forward pass with maximum path acceleration within controllable sets
+			
+			::std::vector<::rl::math::Real> x(s.size(), 0);
+			
+			for (::std::size_t i = 0; i < segments.size(); ++i)
+			{
+				::rl::math::Real delta = s[i + 1] - s[i];
+				::rl::math::Real min = (lower[i + 1] - x[i]) / (2 * delta);
+				::rl::math::Real max = (upper[i + 1] - x[i]) / (2 * delta);
+				
+				for (::std::ptrdiff_t j = 0; j < constraints[i].rows(); ++j)
+				{
+					if (constraints[i](j, 0) > ::std::numeric_limits<::rl::math::Real>::epsilon())
+					{
+						max = ::std::min(max, (constraints[i](j, 2) - constraints[i](j, 1) * x[i]) / constraints[i](j, 0));
+					}
+					else if (constraints[i](j, 0) < -::std::numeric_limits<::rl::math::Real>::epsilon())
+					{
+						min = ::std::max(min, (constraints[i](j, 2) - constraints[i](j, 1) * x[i]) / constraints[i](j, 0));
+					}
+				}
+				
+				::rl::math::Real u = max < min ? min : max;
+				x[i + 1] = ::std::min(::std::max(x[i] + 2 * delta * u, lower[i + 1]), upper[i + 1]);
+			}
+			
+			// geometric polynomials composed with s(t) = s0 + sd0 * t + u / 2 * t^2 of each grid interval
+			
+			::rl::math::Spline<::rl::math::Vector> trajectory;
+			
+			for (::std::size_t i = 0; i < segments.size(); ++i)
+			{
+				::rl::math::Real delta = s[i + 1] - s[i];
+				::rl::math::Real sd0 = ::std::sqrt(x[i]);
+				::rl::math::Real sd1 = ::std::sqrt(x[i + 1]);
+				
+				if (sd0 + sd1 <= ::std::numeric_limits<::rl::math::Real>::epsilon())
+				{
+					throw Exception("rl::plan::Topp::process() - Path velocity is zero between waypoints");
+				}
+				
+				const ::rl::math::Polynomial<::rl::math::Vector>& p = geometric[segments[i]];
+				
+				::std::vector<::rl::math::Real> r(3);
+				r[0] = s[i] - starts[segments[i]];
+				r[1] = sd0;
+				r[2] = (x[i + 1] - x[i]) / (4 * delta);
+				
+				::rl::math::Polynomial<::rl::math::Vector> polynomial(2 * p.degree());
+				polynomial.upper() = 2 * delta / (sd0 + sd1);
+				
+				for (::std::size_t j = 0; j < 2 * p.degree() + 1; ++j)
+				{
+					polynomial.coefficient(j) = ::rl::math::Vector::Zero(p.coefficient(0).size());
+				}
+				
+				::std::vector<::rl::math::Real> power(1, 1);
+				
+				for (::std::size_t j = 0; j < p.degree() + 1; ++j)
+				{
+					for (::std::size_t k = 0; k < power.size(); ++k)
+					{
+						polynomial.coefficient(k) += power[k] * p.coefficient(j);
+					}
+					
+					::std::vector<::rl::math::Real> next(power.size() + 2, 0);
+					
+					for (::std::size_t k = 0; k < power.size(); ++k)
+					{
+						for (::std::size_t l = 0; l < r.size(); ++l)
+						{
+							next[k + l] += power[k] * r[l];
+						}
+					}
+					
+					power.swap(next);
+				}
+				
+				trajectory.push_back(polynomial);
+			}
+			
+			return trajectory;
+		}
+		
+		void
+		Topp::setModel(::rl::mdl::Model* model)
+		{
+			this->model = model;
+		}
+	}
+}
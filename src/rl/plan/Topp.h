@@ -0,0 +1,139 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef RL_PLAN_TOPP_H
+#define RL_PLAN_TOPP_H
+
+#include <vector>
+#include <rl/math/Matrix.h>
+#include <rl/math/Spline.h>
+#include <rl/math/Vector.h>
+#include <rl/plan/export.h>
+
+#include "VectorList.h"
+
+namespace rl
+{
+	namespace mdl
+	{
+		class Dynamic;
+		class Model;
+	}
+	
+	namespace plan
+	{
+		/**
+		 * Time-optimal path parameterization by reachability analysis.
+		 *
+		 * Blends the waypoints of a path with parabolic segments and finds
+		 * the fastest traversal of the resulting geometric path, starting and
+		 * ending at rest, subject to joint speed limits of the model, joint
+		 * acceleration limits and optionally joint torque limits. The path
+		 * is discretized into a grid that includes the ends of all blends.
+		 * A backward pass computes the controllable path velocities at each
+		 * grid point and a forward pass greedily selects the maximum path
+		 * acceleration within them.
+		 *
+		 * Hung Pham and Quang-Cuong Pham. A new approach to time-optimal path
+		 * parameterization based on reachability analysis. IEEE Transactions on
+		 * Robotics, 34(3):645-659, June 2018.
+		 *
+		 * http://dx.doi.org/10.1109/TRO.2018.2819195
+		 */
+		class RL_PLAN_EXPORT Topp
+		{
+		public:
+			Topp();
+			
+			virtual ~Topp();
+			
+			::rl::mdl::Model* getModel() const;
+			
+			/**
+			 * Compute trajectory along path.
+			 *
+			 * Returns a spline with one polynomial of up to degree four per grid
+			 * interval, which follows the blended path exactly with constant path
+			 * acceleration, or an empty spline if the path has less than two
+			 * distinct waypoints. Torque limits require a model of type
+			 * rl::mdl::Dynamic.
+			 *
+			 * @throws Exception if the sizes of the limits or the path do not match
+			 * the degrees of freedom of the model, or if no path velocity
+			 * satisfies the limits, e.g., if the model cannot hold a configuration
+			 * of the path against gravity with the given torque limits
+			 */
+			::rl::math::Spline<::rl::math::Vector> process(const VectorList& path) const;
+			
+			void setModel(::rl::mdl::Model* model);
+			
+			/** Maximum acceleration of each joint. */
+			::rl::math::Vector acceleration;
+			
+			/**
+			 * Duration of parabolic blends, relative to the shortest path segment.
+			 *
+			 * Smaller values keep the trajectory closer to the verified straight
+			 * path segments, but require lower speeds at the waypoints.
+			 */
+			::rl::math::Real blend;
+			
+			/** Model providing the maximum speed of each joint. */
+			::rl::mdl::Model* model;
+			
+			/** Number of grid intervals along the path. */
+			::std::size_t steps;
+			
+			/** Maximum torque of each joint, no torque limits if empty. */
+			::rl::math::Vector torque;
+			
+		protected:
+			
+		private:
+			/**
+			 * Constraints on path acceleration and path velocity squared.
+			 *
+			 * Sets each row to a, b, c of a * u + b * x <= c for the speed,
+			 * acceleration and torque limits at a configuration with given
+			 * path derivatives.
+			 */
+			void constrain(const ::std::vector<::rl::math::Vector>& q, const ::rl::math::Vector& speed, ::rl::mdl::Dynamic* dynamic, ::rl::math::Matrix& constraints) const;
+			
+			/**
+			 * Range of the path velocity squared that satisfies all constraints
+			 * of a grid point and reaches the range of the next grid point.
+			 *
+			 * Solves both linear programs in path acceleration and path velocity
+			 * squared by enumerating the vertices of the feasible polygon.
+			 *
+			 * @return false if no path velocity satisfies all constraints
+			 */
+			bool controllable(const ::rl::math::Matrix& constraints, const ::rl::math::Real& delta, const ::rl::math::Real& min, const ::rl::math::Real& max, ::rl::math::Real& lower, ::rl::math::Real& upper) const;
+		};
+	}
+}
+
+#endif // RL_PLAN_TOPP_H
@@ -33,6 +33,7 @@
 
 #include "Body.h"
 #include "Model.h"
+#include "Scene.h"
 #include "Shape.h"
 
 namespace rl
@@ -59,6 +60,7 @@ namespace rl
 		Body::add(Shape* shape)
 		{
 			this->shapes.push_back(shape);
+			this->model->getScene()->increaseRevision();
 		}
 		
 		Body::Iterator
@@ -140,6 +142,7 @@ namespace rl
 			if (found != this->shapes.end())
 			{
 				this->shapes.erase(found);
+				this->model->getScene()->increaseRevision();
 			}
 		}
 		
@@ -41,7 +41,8 @@ namespace rl
 			Base(),
 			bodies(),
 			scene(scene),
-			name()
+			name(),
+			revision(0)
 		{
 		}
 		
@@ -53,6 +54,7 @@ namespace rl
 		Model::add(Body* body)
 		{
 			this->bodies.push_back(body);
+			this->scene->increaseRevision();
 		}
 		
 		Model::Iterator
@@ -85,12 +87,24 @@ namespace rl
 			return this->bodies.size();
 		}
 		
+		const ::std::size_t&
+		Model::getRevision() const
+		{
+			return this->revision;
+		}
+		
 		Scene*
 		Model::getScene() const
 		{
 			return this->scene;
 		}
 		
+		void
+		Model::increaseRevision()
+		{
+			++this->revision;
+		}
+		
 		void
 		Model::remove(Body* body)
 		{
@@ -99,6 +113,7 @@ namespace rl
 			if (found != this->bodies.end())
 			{
 				this->bodies.erase(found);
+				this->scene->increaseRevision();
 			}
 		}
 		
@@ -64,8 +64,15 @@ namespace rl
 			
 			::std::size_t getNumBodies() const;
 			
+			/**
+			 * Counter of changes to the frames of the bodies of the model.
+			 */
+			const ::std::size_t& getRevision() const;
+			
 			Scene* getScene() const;
 			
+			void increaseRevision();
+			
 			virtual void remove(Body* body);
 			
 			virtual void setName(const ::std::string& name);
@@ -77,6 +84,8 @@ namespace rl
 			
 		private:
 			::std::string name;
+			
+			::std::size_t revision;
 		};
 	}
 }
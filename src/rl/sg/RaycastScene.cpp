@@ -24,6 +24,9 @@
 // POSSIBILITY OF SUCH DAMAGE.
 //
 
+#include <cassert>
+#include <limits>
+
 #include "RaycastScene.h"
 
 namespace rl
@@ -38,5 +41,30 @@ namespace rl
 		RaycastScene::~RaycastScene()
 		{
 		}
+		
+		void
+		RaycastScene::raycast(const ::std::vector<::rl::math::Vector3>& sources, const ::std::vector<::rl::math::Vector3>& targets, ::std::vector<Shape*>& shapes, ::rl::math::Vector& distances)
+		{
+			assert(sources.size() == targets.size());
+			
+			shapes.resize(sources.size());
+			distances.resize(sources.size());
+			
+			for (::std::size_t i = 0; i < sources.size(); ++i)
+			{
+				::rl::math::Real distance;
+				shapes[i] = this->raycast(sources[i], targets[i], distance);
+				
+				if (nullptr == shapes[i] || distance > (targets[i] - sources[i]).norm())
+				{
+					shapes[i] = nullptr;
+					distances(i) = ::std::numeric_limits<::rl::math::Real>::quiet_NaN();
+				}
+				else
+				{
+					distances(i) = distance;
+				}
+			}
+		}
 	}
 }
@@ -27,6 +27,7 @@
 #ifndef RL_SG_RAYCASTSCENE_H
 #define RL_SG_RAYCASTSCENE_H
 
+#include <vector>
 #include <rl/math/Vector.h>
 
 #include "Scene.h"
@@ -44,6 +45,20 @@ namespace rl
 			
 			virtual ~RaycastScene();
 			
+			/**
+			 * Cast a batch of rays against the whole scene.
+			 *
+			 * Only hits between source and target are reported. The default
+			 * implementation casts each ray on its own, backends may override
+			 * this to share broad-phase work across the batch.
+			 *
+			 * @param[in] sources Ray origins
+			 * @param[in] targets Ray end points, same size as sources
+			 * @param[out] shapes Closest shape per ray, nullptr if nothing was hit
+			 * @param[out] distances Distance to closest shape per ray, NaN if nothing was hit
+			 */
+			virtual void raycast(const ::std::vector<::rl::math::Vector3>& sources, const ::std::vector<::rl::math::Vector3>& targets, ::std::vector<Shape*>& shapes, ::rl::math::Vector& distances);
+			
 			virtual Shape* raycast(const ::rl::math::Vector3& source, const ::rl::math::Vector3& target, ::rl::math::Real& distance) = 0;
 			
 			virtual bool raycast(Shape* shape, const ::rl::math::Vector3& source, const ::rl::math::Vector3& target, ::rl::math::Real& distance) = 0;
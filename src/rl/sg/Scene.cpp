@@ -36,7 +36,8 @@ namespace rl
 		Scene::Scene() :
 			Base(),
 			models(),
-			name()
+			name(),
+			revision(0)
 		{
 		}
 		
@@ -48,6 +49,7 @@ namespace rl
 		Scene::add(Model* model)
 		{
 			this->models.push_back(model);
+			this->increaseRevision();
 		}
 		
 		Scene::Iterator
@@ -80,6 +82,18 @@ namespace rl
 			return this->models.size();
 		}
 		
+		const ::std::size_t&
+		Scene::getRevision() const
+		{
+			return this->revision;
+		}
+		
+		void
+		Scene::increaseRevision()
+		{
+			++this->revision;
+		}
+		
 		bool
 		Scene::isScalingSupported() const
 		{
@@ -101,6 +115,7 @@ namespace rl
 			if (found != this->models.end())
 			{
 				this->models.erase(found);
+				this->increaseRevision();
 			}
 		}
 		
@@ -64,6 +64,17 @@ namespace rl
 			
 			::std::size_t getNumModels() const;
 			
+			/**
+			 * Counter of structural changes to the scene.
+			 *
+			 * Increased whenever a model, body, or shape is added or removed, or
+			 * the transform of a shape changes. Frames of bodies are tracked by
+			 * Model::getRevision().
+			 */
+			const ::std::size_t& getRevision() const;
+			
+			void increaseRevision();
+			
 			virtual bool isScalingSupported() const;
 			
 			RL_SG_DEPRECATED void load(const ::std::string& filename, const bool& doBoundingBoxPoints = false, const bool& doPoints = false);
@@ -77,6 +88,8 @@ namespace rl
 			
 		private:
 			::std::string name;
+			
+			::std::size_t revision;
 		};
 	}
 }
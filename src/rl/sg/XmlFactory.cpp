@@ -60,7 +60,7 @@ namespace rl
 		void
 		XmlFactory::load(const ::std::string& filename, Scene* scene)
 		{
-			this->load(filename, scene, false, false);
+			this->load(filename, scene, true, false);
 		}
 		
 		void
@@ -277,6 +277,18 @@ namespace rl
 							::SoCallbackAction callbackAction;
 							callbackAction.addTriangleCallback(::SoVRMLGeometry::getClassTypeId(), XmlFactory::triangleCallback, &body->points);
 							callbackAction.apply(pathList);
+							
+							if (!doBoundingBoxPoints && !body->points.empty())
+							{
+								body->max = body->points[0];
+								body->min = body->points[0];
+								
+								for (::std::size_t l = 1; l < body->points.size(); ++l)
+								{
+									body->max = body->max.cwiseMax(body->points[l]);
+									body->min = body->min.cwiseMin(body->points[l]);
+								}
+							}
 						}
 					}
 				}
@@ -290,26 +302,22 @@ namespace rl
 		{
 			::std::vector<::rl::math::Vector3>* points = static_cast<::std::vector<::rl::math::Vector3>*>(userData);
 			
-			::rl::math::Vector3 p1;
-			p1(0) = v1->getPoint()[0];
-			p1(1) = v1->getPoint()[1];
-			p1(2) = v1->getPoint()[2];
+			// vertices are in object coordinates of the shape, move them into the body frame
+			
+			::SbVec3f p1;
+			action->getModelMatrix().multVecMatrix(v1->getPoint(), p1);
 			
-			points->push_back(p1);
+			points->push_back(::rl::math::Vector3(p1[0], p1[1], p1[2]));
 			
-			::rl::math::Vector3 p2;
-			p2(0) = v2->getPoint()[0];
-			p2(1) = v2->getPoint()[1];
-			p2(2) = v2->getPoint()[2];
+			::SbVec3f p2;
+			action->getModelMatrix().multVecMatrix(v2->getPoint(), p2);
 			
-			points->push_back(p2);
+			points->push_back(::rl::math::Vector3(p2[0], p2[1], p2[2]));
 			
-			::rl::math::Vector3 p3;
-			p3(0) = v3->getPoint()[0];
-			p3(1) = v3->getPoint()[1];
-			p3(2) = v3->getPoint()[2];
+			::SbVec3f p3;
+			action->getModelMatrix().multVecMatrix(v3->getPoint(), p3);
 			
-			points->push_back(p3);
+			points->push_back(::rl::math::Vector3(p3[0], p3[1], p3[2]));
 		}
 	}
 }
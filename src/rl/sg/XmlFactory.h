@@ -42,8 +42,18 @@ namespace rl
 			
 			virtual ~XmlFactory();
 			
+			/**
+			 * Load scene with bounding boxes of bodies, but without points.
+			 */
 			void load(const ::std::string& filename, Scene* scene);
 			
+			/**
+			 * @param[in] doBoundingBoxPoints Store bounding box of each body in
+			 * Body::min and Body::max
+			 * @param[in] doPoints Store triangle vertices of each body in body
+			 * coordinates in Body::points, bounding box is derived from these
+			 * if not requested separately
+			 */
 			void load(const ::std::string& filename, Scene* scene, const bool& doBoundingBoxPoints, const bool& doPoints);
 			
 		protected:
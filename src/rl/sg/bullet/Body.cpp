@@ -104,6 +104,8 @@ namespace rl
 					static_cast<::btScalar>(frame(1, 0)), static_cast<::btScalar>(frame(1, 1)), static_cast<::btScalar>(frame(1, 2)),
 					static_cast<::btScalar>(frame(2, 0)), static_cast<::btScalar>(frame(2, 1)), static_cast<::btScalar>(frame(2, 2))
 				);
+				
+				this->getModel()->increaseRevision();
 			}
 		}
 	}
@@ -24,6 +24,7 @@
 // POSSIBILITY OF SUCH DAMAGE.
 //
 
+#include <cassert>
 #include <BulletCollision/NarrowPhaseCollision/btConvexPenetrationDepthSolver.h>
 #include <BulletCollision/NarrowPhaseCollision/btGjkEpaPenetrationDepthSolver.h>
 #include <BulletCollision/NarrowPhaseCollision/btGjkPairDetector.h>
@@ -218,6 +219,47 @@ namespace rl
 				return false;
 			}
 			
+			void
+			Scene::raycast(const ::std::vector<::rl::math::Vector3>& sources, const ::std::vector<::rl::math::Vector3>& targets, ::std::vector<::rl::sg::Shape*>& shapes, ::rl::math::Vector& distances)
+			{
+				assert(sources.size() == targets.size());
+				
+				shapes.resize(sources.size());
+				distances.resize(sources.size());
+				
+				for (::std::size_t i = 0; i < sources.size(); ++i)
+				{
+					::btVector3 rayFromWorld(
+						static_cast<::btScalar>(sources[i].x()),
+						static_cast<::btScalar>(sources[i].y()),
+						static_cast<::btScalar>(sources[i].z())
+					);
+					
+					::btVector3 rayToWorld(
+						static_cast<::btScalar>(targets[i].x()),
+						static_cast<::btScalar>(targets[i].y()),
+						static_cast<::btScalar>(targets[i].z())
+					);
+					
+					RayResultCallback resultCallback;
+					
+					this->world.rayTest(rayFromWorld, rayToWorld, resultCallback);
+					
+					if (nullptr != resultCallback.collisionShape)
+					{
+						::btVector3 hitPointWorld;
+						hitPointWorld.setInterpolate3(rayFromWorld, rayToWorld, resultCallback.m_closestHitFraction);
+						distances(i) = rayFromWorld.distance(hitPointWorld);
+						shapes[i] = static_cast<Shape*>(resultCallback.collisionShape->getUserPointer());
+					}
+					else
+					{
+						distances(i) = ::std::numeric_limits<::rl::math::Real>::quiet_NaN();
+						shapes[i] = nullptr;
+					}
+				}
+			}
+			
 			::rl::sg::Shape*
 			Scene::raycast(const ::rl::math::Vector3& source, const ::rl::math::Vector3& target, ::rl::math::Real& distance)
 			{
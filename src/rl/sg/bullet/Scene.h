@@ -27,6 +27,7 @@
 #ifndef RL_SG_BULLET_SCENE_H
 #define RL_SG_BULLET_SCENE_H
 
+#include <vector>
 #include <btBulletCollisionCommon.h>
 
 #include "../DepthScene.h"
@@ -76,6 +77,14 @@ namespace rl
 				
 				bool isScalingSupported() const;
 				
+				using ::rl::sg::RaycastScene::raycast;
+				
+				/**
+				 * Casts each ray through the dynamic AABB tree of the world, so only
+				 * objects whose bounding box the ray crosses are tested.
+				 */
+				void raycast(const ::std::vector<::rl::math::Vector3>& sources, const ::std::vector<::rl::math::Vector3>& targets, ::std::vector<::rl::sg::Shape*>& shapes, ::rl::math::Vector& distances);
+				
 				::rl::sg::Shape* raycast(const ::rl::math::Vector3& source, const ::rl::math::Vector3& target, ::rl::math::Real& distance);
 				
 				bool raycast(::rl::sg::Shape* shape, const ::rl::math::Vector3& source, const ::rl::math::Vector3& target, ::rl::math::Real& distance);
@@ -193,6 +193,8 @@ namespace rl
 						break;
 					}
 				}
+				
+				this->getBody()->getModel()->getScene()->increaseRevision();
 			}
 			
 			void
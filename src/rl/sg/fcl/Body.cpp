@@ -62,6 +62,7 @@ namespace rl
 				fcl->update(this->frame);
 				this->manager.registerObject(fcl->getCollisionObject());
 				static_cast<Model*>(getModel())->addCollisionObject(fcl->getCollisionObject(), this);
+				this->getModel()->getScene()->increaseRevision();
 			}
 			
 			::rl::sg::Shape*
@@ -87,6 +88,7 @@ namespace rl
 					this->shapes.erase(found);
 					this->manager.unregisterObject(fcl->getCollisionObject());
 					static_cast<Model*>(this->getModel())->removeCollisionObject(fcl->getCollisionObject());
+					this->getModel()->getScene()->increaseRevision();
 				}
 			}
 			
@@ -99,6 +101,8 @@ namespace rl
 				{
 					static_cast<Shape*>(*i)->update(this->frame);
 				}
+				
+				this->getModel()->increaseRevision();
 			}
 		}
 	}
@@ -63,6 +63,8 @@ namespace rl
 				{
 					this->manager.registerObjects(objects);
 				}
+				
+				this->getScene()->increaseRevision();
 			}
 			
 			void
@@ -93,6 +95,8 @@ namespace rl
 					{
 						this->manager.unregisterObject(objects[i]);
 					}
+					
+					this->getScene()->increaseRevision();
 				}
 			}
 			
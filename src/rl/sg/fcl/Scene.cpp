@@ -90,6 +90,8 @@ namespace rl
 				{
 					this->manager.registerObjects(objects);
 				}
+				
+				this->increaseRevision();
 			}
 			
 			void
@@ -392,6 +394,8 @@ namespace rl
 					{
 						this->manager.unregisterObject(objects[i]);
 					}
+					
+					this->increaseRevision();
 				}
 			}
 			
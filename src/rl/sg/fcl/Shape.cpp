@@ -46,6 +46,8 @@
 
 #include "../Exception.h"
 #include "Body.h"
+#include "Model.h"
+#include "Scene.h"
 #include "Shape.h"
 
 namespace rl
@@ -293,6 +295,8 @@ namespace rl
 			{
 				this->transform = transform;
 				this->update(this->frame);
+				
+				this->getBody()->getModel()->getScene()->increaseRevision();
 			}
 			
 			void
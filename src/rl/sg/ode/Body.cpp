@@ -111,6 +111,8 @@ namespace rl
 				rotation[11] = 0;
 				
 				::dBodySetRotation(this->body, rotation);
+				
+				this->getModel()->increaseRevision();
 			}
 		}
 	}
@@ -24,6 +24,8 @@
 // POSSIBILITY OF SUCH DAMAGE.
 //
 
+#include <cassert>
+
 #include "Body.h"
 #include "Model.h"
 #include "Scene.h"
@@ -169,6 +171,58 @@ namespace rl
 				::dSpaceCollide(reinterpret_cast<::dSpaceID>(o2), data, &Scene::bodySimpleCallback);
 			}
 			
+			void
+			Scene::raycast(const ::std::vector<::rl::math::Vector3>& sources, const ::std::vector<::rl::math::Vector3>& targets, ::std::vector<::rl::sg::Shape*>& shapes, ::rl::math::Vector& distances)
+			{
+				assert(sources.size() == targets.size());
+				
+				shapes.resize(sources.size());
+				distances.resize(sources.size());
+				
+				::dSpaceID rays = ::dSimpleSpaceCreate(nullptr);
+				
+				::std::vector<::dContactGeom> contacts(sources.size());
+				
+				for (::std::size_t i = 0; i < sources.size(); ++i)
+				{
+					::dGeomID ray = ::dCreateRay(rays, static_cast<::dReal>((targets[i] - sources[i]).norm()));
+					
+					::dGeomRaySet(
+						ray,
+						static_cast<::dReal>(sources[i].x()),
+						static_cast<::dReal>(sources[i].y()),
+						static_cast<::dReal>(sources[i].z()),
+						static_cast<::dReal>(targets[i].x() - sources[i].x()),
+						static_cast<::dReal>(targets[i].y() - sources[i].y()),
+						static_cast<::dReal>(targets[i].z() - sources[i].z())
+					);
+					
+					contacts[i].depth = ::std::numeric_limits<::dReal>::max();
+					contacts[i].g1 = nullptr;
+					contacts[i].g2 = nullptr;
+					
+					::dGeomSetData(ray, &contacts[i]);
+				}
+				
+				::dSpaceCollide2(reinterpret_cast<::dGeomID>(rays), reinterpret_cast<::dGeomID>(this->space), rays, &Scene::raysNearCallback);
+				
+				for (::std::size_t i = 0; i < sources.size(); ++i)
+				{
+					if (nullptr != contacts[i].g2)
+					{
+						distances(i) = contacts[i].depth;
+						shapes[i] = static_cast<::rl::sg::Shape*>(::dGeomGetData(contacts[i].g2));
+					}
+					else
+					{
+						distances(i) = ::std::numeric_limits<::rl::math::Real>::quiet_NaN();
+						shapes[i] = nullptr;
+					}
+				}
+				
+				::dSpaceDestroy(rays);
+			}
+			
 			::rl::sg::Shape*
 			Scene::raycast(const ::rl::math::Vector3& source, const ::rl::math::Vector3& target, ::rl::math::Real& distance)
 			{
@@ -269,6 +323,33 @@ namespace rl
 				}
 			}
 			
+			void
+			Scene::raysNearCallback(void* data, ::dGeomID o1, ::dGeomID o2)
+			{
+				if (::dGeomIsSpace(o1) || ::dGeomIsSpace(o2))
+				{
+					::dSpaceCollide2(o1, o2, data, &Scene::raysNearCallback);
+				}
+				else
+				{
+					::dGeomID ray = static_cast<::dSpaceID>(data) == ::dGeomGetSpace(o1) ? o1 : o2;
+					::dGeomID geom = ray == o1 ? o2 : o1;
+					::dContactGeom* nearest = static_cast<::dContactGeom*>(::dGeomGetData(ray));
+					
+					::dContactGeom contacts[1];
+					
+					if (::dCollide(ray, geom, 1, contacts, sizeof(::dContactGeom)) > 0)
+					{
+						if (contacts[0].depth < nearest->depth)
+						{
+							nearest->depth = contacts[0].depth;
+							nearest->g1 = ray;
+							nearest->g2 = geom;
+						}
+					}
+				}
+			}
+			
 			void
 			Scene::shapeDepthCallback(void* data, ::dGeomID o1, ::dGeomID o2)
 			{
@@ -27,6 +27,7 @@
 #ifndef RL_SG_ODE_SCENE_H
 #define RL_SG_ODE_SCENE_H
 
+#include <vector>
 #include <ode/ode.h>
 
 #include "../DepthScene.h"
@@ -65,6 +66,14 @@ namespace rl
 				
 				bool isColliding();
 				
+				using ::rl::sg::RaycastScene::raycast;
+				
+				/**
+				 * Collides a temporary space holding all rays with the scene
+				 * in a single pass.
+				 */
+				void raycast(const ::std::vector<::rl::math::Vector3>& sources, const ::std::vector<::rl::math::Vector3>& targets, ::std::vector<::rl::sg::Shape*>& shapes, ::rl::math::Vector& distances);
+				
 				::rl::sg::Shape* raycast(const ::rl::math::Vector3& source, const ::rl::math::Vector3& target, ::rl::math::Real& distance);
 				
 				bool raycast(::rl::sg::Shape* shape, const ::rl::math::Vector3& source, const ::rl::math::Vector3& target, ::rl::math::Real& distance);
@@ -84,6 +93,8 @@ namespace rl
 				
 				static void rayNearCallback(void* data, ::dGeomID o1, ::dGeomID o2);
 				
+				static void raysNearCallback(void* data, ::dGeomID o1, ::dGeomID o2);
+				
 				static void shapeDepthCallback(void* data, ::dGeomID o1, ::dGeomID o2);
 				
 				static void shapeSimpleCallback(void* data, ::dGeomID o1, ::dGeomID o2);
@@ -187,6 +187,8 @@ namespace rl
 				rotation[11] = 0;
 				
 				::dGeomSetOffsetRotation(this->geom, rotation);
+				
+				this->getBody()->getModel()->getScene()->increaseRevision();
 			}
 		}
 	}
@@ -72,6 +72,8 @@ namespace rl
 				{
 					static_cast<Shape*>(*i)->update();
 				}
+				
+				this->getModel()->increaseRevision();
 			}
 		}
 	}
@@ -35,6 +35,8 @@
 #include <Inventor/VRMLnodes/SoVRMLSphere.h>
 
 #include "Body.h"
+#include "Model.h"
+#include "Scene.h"
 #include "Shape.h"
 
 namespace rl
@@ -97,6 +99,8 @@ namespace rl
 				this->transform = transform;
 				
 				this->update();
+				
+				this->getBody()->getModel()->getScene()->increaseRevision();
 			}
 			
 			void
@@ -0,0 +1,666 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+#include "../Exception.h"
+#include "Field.h"
+
+namespace rl
+{
+	namespace sg
+	{
+		namespace sdf
+		{
+			const ::std::size_t Field::maximum = 128;
+			
+			Field::Field() :
+				center(::rl::math::Vector3::Zero()),
+				origin(::rl::math::Vector3::Zero()),
+				radius(0),
+				resolution(0),
+				size(),
+				spheres(),
+				values()
+			{
+				this->size.fill(0);
+			}
+			
+			Field::~Field()
+			{
+			}
+			
+			void
+			Field::build(const ::std::vector<::rl::math::Vector3>& vertices, const ::rl::math::Real& resolution)
+			{
+				this->spheres.clear();
+				this->values.clear();
+				this->size.fill(0);
+				
+				if (vertices.size() < 3)
+				{
+					return;
+				}
+				
+				::rl::math::Vector3 minimum = vertices[0];
+				::rl::math::Vector3 maximum = vertices[0];
+				
+				for (::std::size_t i = 1; i < vertices.size(); ++i)
+				{
+					minimum = minimum.cwiseMin(vertices[i]);
+					maximum = maximum.cwiseMax(vertices[i]);
+				}
+				
+				this->center = (minimum + maximum) / 2;
+				this->radius = 0;
+				
+				for (::std::size_t i = 0; i < vertices.size(); ++i)
+				{
+					this->radius = ::std::max(this->radius, (vertices[i] - this->center).norm());
+				}
+				
+				// two cells of margin on each side keep the surface inside of the grid
+				
+				this->resolution = ::std::max(resolution, (maximum - minimum).maxCoeff() / (Field::maximum - 5));
+				
+				if (this->resolution <= 0)
+				{
+					this->resolution = ::std::max(this->radius, static_cast<::rl::math::Real>(1));
+				}
+				
+				this->origin = minimum - ::rl::math::Vector3::Constant(2 * this->resolution);
+				
+				for (::std::size_t i = 0; i < 3; ++i)
+				{
+					this->size[i] = static_cast<::std::size_t>(::std::ceil((maximum(i) - minimum(i)) / this->resolution)) + 5;
+				}
+				
+				::std::vector<::rl::math::Vector3> closest(this->size[0] * this->size[1] * this->size[2]);
+				::std::vector<bool> valid(closest.size(), false);
+				
+				// exact distances in a narrow band of one cell around each triangle
+				
+				for (::std::size_t i = 0; i + 2 < vertices.size(); i += 3)
+				{
+					const ::rl::math::Vector3& a = vertices[i];
+					const ::rl::math::Vector3& b = vertices[i + 1];
+					const ::rl::math::Vector3& c = vertices[i + 2];
+					
+					::std::array<::std::size_t, 3> lower;
+					::std::array<::std::size_t, 3> upper;
+					
+					for (::std::size_t j = 0; j < 3; ++j)
+					{
+						::rl::math::Real l = (::std::min(a(j), ::std::min(b(j), c(j))) - this->origin(j)) / this->resolution - 1;
+						::rl::math::Real u = (::std::max(a(j), ::std::max(b(j), c(j))) - this->origin(j)) / this->resolution + 1;
+						lower[j] = static_cast<::std::size_t>(::std::max(::std::floor(l), static_cast<::rl::math::Real>(0)));
+						upper[j] = ::std::min(static_cast<::std::size_t>(::std::ceil(u)), this->size[j] - 1);
+					}
+					
+					for (::std::size_t z = lower[2]; z <= upper[2]; ++z)
+					{
+						for (::std::size_t y = lower[1]; y <= upper[1]; ++y)
+						{
+							for (::std::size_t x = lower[0]; x <= upper[0]; ++x)
+							{
+								::std::size_t j = this->index(x, y, z);
+								::rl::math::Vector3 p = this->position(x, y, z);
+								::rl::math::Vector3 q = Field::closestPoint(p, a, b, c);
+								
+								if (!valid[j] || (p - q).squaredNorm() < (p - closest[j]).squaredNorm())
+								{
+									closest[j] = q;
+									valid[j] = true;
+								}
+							}
+						}
+					}
+				}
+				
+				this->propagate(closest, valid, true);
+				this->propagate(closest, valid, false);
+				this->propagate(closest, valid, true);
+				this->propagate(closest, valid, false);
+				
+				// sign by parity of crossings along rays in x-direction, slightly offset to avoid hitting edges
+				
+				::std::vector<::std::vector<::rl::math::Real>> crossings(this->size[1] * this->size[2]);
+				::rl::math::Real offset[2] = {::std::sqrt(static_cast<::rl::math::Real>(2)) * static_cast<::rl::math::Real>(1.0e-4) * this->resolution, ::std::sqrt(static_cast<::rl::math::Real>(3)) * static_cast<::rl::math::Real>(1.0e-4) * this->resolution};
+				
+				for (::std::size_t i = 0; i + 2 < vertices.size(); i += 3)
+				{
+					const ::rl::math::Vector3& a = vertices[i];
+					const ::rl::math::Vector3& b = vertices[i + 1];
+					const ::rl::math::Vector3& c = vertices[i + 2];
+					
+					::rl::math::Real area = (b(1) - a(1)) * (c(2) - a(2)) - (b(2) - a(2)) * (c(1) - a(1));
+					
+					if (0 == area)
+					{
+						continue;
+					}
+					
+					::rl::math::Real l[2];
+					::rl::math::Real u[2];
+					
+					for (::std::size_t j = 0; j < 2; ++j)
+					{
+						l[j] = (::std::min(a(j + 1), ::std::min(b(j + 1), c(j + 1))) - this->origin(j + 1) - offset[j]) / this->resolution;
+						u[j] = (::std::max(a(j + 1), ::std::max(b(j + 1), c(j + 1))) - this->origin(j + 1) - offset[j]) / this->resolution;
+					}
+					
+					for (::std::size_t z = static_cast<::std::size_t>(::std::max(::std::ceil(l[1]), static_cast<::rl::math::Real>(0))); z < this->size[2] && z <= u[1]; ++z)
+					{
+						for (::std::size_t y = static_cast<::std::size_t>(::std::max(::std::ceil(l[0]), static_cast<::rl::math::Real>(0))); y < this->size[1] && y <= u[0]; ++y)
+						{
+							::rl::math::Real py = this->origin(1) + y * this->resolution + offset[0];
+							::rl::math::Real pz = this->origin(2) + z * this->resolution + offset[1];
+							
+							::rl::math::Real wa = (c(1) - b(1)) * (pz - b(2)) - (c(2) - b(2)) * (py - b(1));
+							::rl::math::Real wb = (a(1) - c(1)) * (pz - c(2)) - (a(2) - c(2)) * (py - c(1));
+							::rl::math::Real wc = (b(1) - a(1)) * (pz - a(2)) - (b(2) - a(2)) * (py - a(1));
+							
+							if ((wa >= 0 && wb >= 0 && wc >= 0) || (wa <= 0 && wb <= 0 && wc <= 0))
+							{
+								crossings[y + z * this->size[1]].push_back((wa * a(0) + wb * b(0) + wc * c(0)) / area);
+							}
+						}
+					}
+				}
+				
+				this->values.resize(closest.size());
+				
+				for (::std::size_t z = 0; z < this->size[2]; ++z)
+				{
+					for (::std::size_t y = 0; y < this->size[1]; ++y)
+					{
+						::std::vector<::rl::math::Real>& row = crossings[y + z * this->size[1]];
+						::std::sort(row.begin(), row.end());
+						::std::size_t k = 0;
+						
+						for (::std::size_t x = 0; x < this->size[0]; ++x)
+						{
+							::std::size_t j = this->index(x, y, z);
+							::rl::math::Vector3 p = this->position(x, y, z);
+							
+							while (k < row.size() && row[k] < p(0))
+							{
+								++k;
+							}
+							
+							::rl::math::Real d = valid[j] ? (p - closest[j]).norm() : ::std::numeric_limits<::rl::math::Real>::max();
+							
+							// unpaired crossings of open meshes are treated as outside
+							
+							this->values[j] = static_cast<float>(1 == k % 2 && k < row.size() ? -d : d);
+						}
+					}
+				}
+				
+				this->cover();
+			}
+			
+			::rl::math::Vector3
+			Field::closestPoint(const ::rl::math::Vector3& point, const ::rl::math::Vector3& a, const ::rl::math::Vector3& b, const ::rl::math::Vector3& c)
+			{
+				::rl::math::Vector3 ab = b - a;
+				::rl::math::Vector3 ac = c - a;
+				::rl::math::Vector3 ap = point - a;
+				
+				::rl::math::Real d1 = ab.dot(ap);
+				::rl::math::Real d2 = ac.dot(ap);
+				
+				if (d1 <= 0 && d2 <= 0)
+				{
+					return a;
+				}
+				
+				::rl::math::Vector3 bp = point - b;
+				::rl::math::Real d3 = ab.dot(bp);
+				::rl::math::Real d4 = ac.dot(bp);
+				
+				if (d3 >= 0 && d4 <= d3)
+				{
+					return b;
+				}
+				
+				::rl::math::Real vc = d1 * d4 - d3 * d2;
+				
+				if (vc <= 0 && d1 >= 0 && d3 <= 0)
+				{
+					return a + d1 / (d1 - d3) * ab;
+				}
+				
+				::rl::math::Vector3 cp = point - c;
+				::rl::math::Real d5 = ab.dot(cp);
+				::rl::math::Real d6 = ac.dot(cp);
+				
+				if (d6 >= 0 && d5 <= d6)
+				{
+					return c;
+				}
+				
+				::rl::math::Real vb = d5 * d2 - d1 * d6;
+				
+				if (vb <= 0 && d2 >= 0 && d6 <= 0)
+				{
+					return a + d2 / (d2 - d6) * ac;
+				}
+				
+				::rl::math::Real va = d3 * d6 - d5 * d4;
+				
+				if (va <= 0 && d4 - d3 >= 0 && d5 - d6 >= 0)
+				{
+					return b + (d4 - d3) / ((d4 - d3) + (d5 - d6)) * (c - b);
+				}
+				
+				::rl::math::Real denominator = va + vb + vc;
+				
+				if (denominator <= 0)
+				{
+					return a;
+				}
+				
+				return a + vb / denominator * ab + vc / denominator * ac;
+			}
+			
+			void
+			Field::cover()
+			{
+				// any surface point lies within half a cell diagonal of an occupied grid vertex,
+				// so covering the balls around all occupied vertices covers the geometry
+				
+				::rl::math::Real half = ::std::sqrt(static_cast<::rl::math::Real>(3)) / 2 * this->resolution;
+				
+				::std::vector<::std::size_t> occupied;
+				
+				for (::std::size_t i = 0; i < this->values.size(); ++i)
+				{
+					if (this->values[i] <= half)
+					{
+						occupied.push_back(i);
+					}
+				}
+				
+				// place spheres at the deepest uncovered vertices first
+				
+				::std::vector<::std::pair<float, ::std::size_t>> order(occupied.size());
+				
+				for (::std::size_t i = 0; i < occupied.size(); ++i)
+				{
+					order[i] = ::std::make_pair(this->values[occupied[i]], occupied[i]);
+				}
+				
+				::std::sort(order.begin(), order.end());
+				
+				::std::vector<bool> covered(this->values.size(), false);
+				
+				for (::std::size_t i = 0; i < order.size(); ++i)
+				{
+					::std::size_t j = order[i].second;
+					
+					if (covered[j])
+					{
+						continue;
+					}
+					
+					::std::size_t x = j % this->size[0];
+					::std::size_t y = (j / this->size[0]) % this->size[1];
+					::std::size_t z = j / this->size[0] / this->size[1];
+					
+					Sphere sphere;
+					sphere.center = this->position(x, y, z);
+					sphere.radius = ::std::max(-static_cast<::rl::math::Real>(order[i].first), static_cast<::rl::math::Real>(0)) + 2 * half;
+					this->spheres.push_back(sphere);
+					
+					::std::size_t cells = static_cast<::std::size_t>(::std::ceil((sphere.radius - half) / this->resolution));
+					
+					for (::std::size_t w = z - ::std::min(z, cells); w <= ::std::min(z + cells, this->size[2] - 1); ++w)
+					{
+						for (::std::size_t v = y - ::std::min(y, cells); v <= ::std::min(y + cells, this->size[1] - 1); ++v)
+						{
+							for (::std::size_t u = x - ::std::min(x, cells); u <= ::std::min(x + cells, this->size[0] - 1); ++u)
+							{
+								::std::size_t k = this->index(u, v, w);
+								
+								if (!covered[k] && this->values[k] <= half && (this->position(u, v, w) - sphere.center).norm() + half <= sphere.radius)
+								{
+									covered[k] = true;
+								}
+							}
+						}
+					}
+				}
+			}
+			
+			::rl::math::Real
+			Field::distance(const ::rl::math::Vector3& point) const
+			{
+				if (this->values.empty())
+				{
+					return ::std::numeric_limits<::rl::math::Real>::infinity();
+				}
+				
+				::std::size_t cell[3];
+				::rl::math::Real outside = 0;
+				::rl::math::Real t[3];
+				
+				for (::std::size_t i = 0; i < 3; ++i)
+				{
+					::rl::math::Real q = (point(i) - this->origin(i)) / this->resolution;
+					::rl::math::Real clamped = ::std::max(static_cast<::rl::math::Real>(0), ::std::min(q, static_cast<::rl::math::Real>(this->size[i] - 1)));
+					outside += (q - clamped) * (q - clamped);
+					cell[i] = ::std::min(static_cast<::std::size_t>(clamped), this->size[i] - 2);
+					t[i] = clamped - cell[i];
+				}
+				
+				::std::size_t j = this->index(cell[0], cell[1], cell[2]);
+				::std::size_t dy = this->size[0];
+				::std::size_t dz = this->size[0] * this->size[1];
+				
+				::rl::math::Real c00 = this->values[j] * (1 - t[0]) + this->values[j + 1] * t[0];
+				::rl::math::Real c10 = this->values[j + dy] * (1 - t[0]) + this->values[j + dy + 1] * t[0];
+				::rl::math::Real c01 = this->values[j + dz] * (1 - t[0]) + this->values[j + dz + 1] * t[0];
+				::rl::math::Real c11 = this->values[j + dz + dy] * (1 - t[0]) + this->values[j + dz + dy + 1] * t[0];
+				
+				::rl::math::Real c0 = c00 * (1 - t[1]) + c10 * t[1];
+				::rl::math::Real c1 = c01 * (1 - t[1]) + c11 * t[1];
+				
+				::rl::math::Real value = c0 * (1 - t[2]) + c1 * t[2];
+				
+				// the closest point on the grid box is not farther from the geometry than the query point,
+				// giving a lower bound outside of the grid
+				
+				if (outside > 0)
+				{
+					return ::std::sqrt(outside * this->resolution * this->resolution + value * value);
+				}
+				
+				return value;
+			}
+			
+			::rl::math::Real
+			Field::distance(const ::rl::math::Vector3& point, ::rl::math::Vector3& gradient) const
+			{
+				::rl::math::Real step = this->resolution / 2;
+				
+				for (::std::size_t i = 0; i < 3; ++i)
+				{
+					::rl::math::Vector3 delta = ::rl::math::Vector3::Zero();
+					delta(i) = step;
+					gradient(i) = this->distance(point + delta) - this->distance(point - delta);
+				}
+				
+				if (gradient.squaredNorm() > 0 && gradient.allFinite())
+				{
+					gradient.normalize();
+				}
+				else
+				{
+					gradient.setZero();
+				}
+				
+				return this->distance(point);
+			}
+			
+			const ::rl::math::Vector3&
+			Field::getCenter() const
+			{
+				return this->center;
+			}
+			
+			::rl::math::Real
+			Field::getRadius() const
+			{
+				return this->radius;
+			}
+			
+			::rl::math::Real
+			Field::getResolution() const
+			{
+				return this->resolution;
+			}
+			
+			const ::std::array<::std::size_t, 3>&
+			Field::getSize() const
+			{
+				return this->size;
+			}
+			
+			const ::std::vector<Field::Sphere>&
+			Field::getSpheres() const
+			{
+				return this->spheres;
+			}
+			
+			::std::uint64_t
+			Field::hash(const ::std::vector<::rl::math::Vector3>& vertices, const ::rl::math::Real& resolution)
+			{
+				::std::uint64_t hash = 14695981039346656037ULL;
+				
+				for (::std::size_t i = 0; i < vertices.size(); ++i)
+				{
+					const unsigned char* bytes = reinterpret_cast<const unsigned char*>(vertices[i].data());
+					
+					for (::std::size_t j = 0; j < 3 * sizeof(::rl::math::Real); ++j)
+					{
+						hash ^= bytes[j];
+						hash *= 1099511628211ULL;
+					}
+				}
+				
+				const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&resolution);
+				
+				for (::std::size_t j = 0; j < sizeof(::rl::math::Real); ++j)
+				{
+					hash ^= bytes[j];
+					hash *= 1099511628211ULL;
+				}
+				
+				return hash;
+			}
+			
+			::std::size_t
+			Field::index(const ::std::size_t& x, const ::std::size_t& y, const ::std::size_t& z) const
+			{
+				return x + this->size[0] * (y + this->size[1] * z);
+			}
+			
+			bool
+			Field::load(const ::std::string& filename, const ::std::uint64_t& key)
+			{
+				::std::ifstream file(filename, ::std::ios::binary);
+				
+				if (!file)
+				{
+					return false;
+				}
+				
+				FileHeader header;
+				
+				if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+				{
+					return false;
+				}
+				
+				if (0 != ::std::memcmp(header.magic, "RLSD", 4) || 1 != header.version)
+				{
+					return false;
+				}
+				
+				if (key != header.key || sizeof(::rl::math::Real) != header.real)
+				{
+					return false;
+				}
+				
+				for (::std::size_t i = 0; i < 3; ++i)
+				{
+					if (header.size[i] < 2 || header.size[i] > Field::maximum)
+					{
+						throw Exception("rl::sg::sdf::Field::load() - Invalid size in file '" + filename + "'");
+					}
+					
+					this->size[i] = header.size[i];
+				}
+				
+				this->values.resize(this->size[0] * this->size[1] * this->size[2]);
+				this->spheres.resize(header.spheres);
+				
+				file.read(reinterpret_cast<char*>(&this->resolution), sizeof(::rl::math::Real));
+				file.read(reinterpret_cast<char*>(this->origin.data()), 3 * sizeof(::rl::math::Real));
+				file.read(reinterpret_cast<char*>(this->center.data()), 3 * sizeof(::rl::math::Real));
+				file.read(reinterpret_cast<char*>(&this->radius), sizeof(::rl::math::Real));
+				file.read(reinterpret_cast<char*>(this->values.data()), this->values.size() * sizeof(float));
+				
+				for (::std::size_t i = 0; i < this->spheres.size(); ++i)
+				{
+					file.read(reinterpret_cast<char*>(this->spheres[i].center.data()), 3 * sizeof(::rl::math::Real));
+					file.read(reinterpret_cast<char*>(&this->spheres[i].radius), sizeof(::rl::math::Real));
+				}
+				
+				if (!file)
+				{
+					this->size.fill(0);
+					this->spheres.clear();
+					this->values.clear();
+					throw Exception("rl::sg::sdf::Field::load() - Unexpected end of file '" + filename + "'");
+				}
+				
+				return true;
+			}
+			
+			::rl::math::Vector3
+			Field::position(const ::std::size_t& x, const ::std::size_t& y, const ::std::size_t& z) const
+			{
+				return this->origin + this->resolution * ::rl::math::Vector3(x, y, z);
+			}
+			
+			void
+			Field::propagate(::std::vector<::rl::math::Vector3>& closest, ::std::vector<bool>& valid, const bool& forward)
+			{
+				// neighbors already visited in forward order, reversed for the backward sweep
+				
+				::std::vector<::std::array<int, 3>> neighbors;
+				
+				for (int z = -1; z <= 1; ++z)
+				{
+					for (int y = -1; y <= 1; ++y)
+					{
+						for (int x = -1; x <= 1; ++x)
+						{
+							if (z < 0 || (0 == z && y < 0) || (0 == z && 0 == y && x < 0))
+							{
+								::std::array<int, 3> neighbor = {{x, y, z}};
+								
+								if (!forward)
+								{
+									neighbor = {{-x, -y, -z}};
+								}
+								
+								neighbors.push_back(neighbor);
+							}
+						}
+					}
+				}
+				
+				::std::size_t count = closest.size();
+				
+				for (::std::size_t i = 0; i < count; ++i)
+				{
+					::std::size_t j = forward ? i : count - 1 - i;
+					::std::size_t x = j % this->size[0];
+					::std::size_t y = (j / this->size[0]) % this->size[1];
+					::std::size_t z = j / this->size[0] / this->size[1];
+					::rl::math::Vector3 p = this->position(x, y, z);
+					
+					for (::std::size_t k = 0; k < neighbors.size(); ++k)
+					{
+						::std::ptrdiff_t u = static_cast<::std::ptrdiff_t>(x) + neighbors[k][0];
+						::std::ptrdiff_t v = static_cast<::std::ptrdiff_t>(y) + neighbors[k][1];
+						::std::ptrdiff_t w = static_cast<::std::ptrdiff_t>(z) + neighbors[k][2];
+						
+						if (u < 0 || v < 0 || w < 0 || u >= static_cast<::std::ptrdiff_t>(this->size[0]) || v >= static_cast<::std::ptrdiff_t>(this->size[1]) || w >= static_cast<::std::ptrdiff_t>(this->size[2]))
+						{
+							continue;
+						}
+						
+						::std::size_t l = this->index(u, v, w);
+						
+						if (valid[l] && (!valid[j] || (p - closest[l]).squaredNorm() < (p - closest[j]).squaredNorm()))
+						{
+							closest[j] = closest[l];
+							valid[j] = true;
+						}
+					}
+				}
+			}
+			
+			void
+			Field::save(const ::std::string& filename, const ::std::uint64_t& key) const
+			{
+				::std::ofstream file(filename, ::std::ios::binary);
+				
+				if (!file)
+				{
+					throw Exception("rl::sg::sdf::Field::save() - Failed to open file '" + filename + "'");
+				}
+				
+				FileHeader header;
+				::std::memcpy(header.magic, "RLSD", 4);
+				header.version = 1;
+				header.key = key;
+				header.size[0] = this->size[0];
+				header.size[1] = this->size[1];
+				header.size[2] = this->size[2];
+				header.spheres = this->spheres.size();
+				header.real = sizeof(::rl::math::Real);
+				header.reserved = 0;
+				
+				file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+				file.write(reinterpret_cast<const char*>(&this->resolution), sizeof(::rl::math::Real));
+				file.write(reinterpret_cast<const char*>(this->origin.data()), 3 * sizeof(::rl::math::Real));
+				file.write(reinterpret_cast<const char*>(this->center.data()), 3 * sizeof(::rl::math::Real));
+				file.write(reinterpret_cast<const char*>(&this->radius), sizeof(::rl::math::Real));
+				file.write(reinterpret_cast<const char*>(this->values.data()), this->values.size() * sizeof(float));
+				
+				for (::std::size_t i = 0; i < this->spheres.size(); ++i)
+				{
+					file.write(reinterpret_cast<const char*>(this->spheres[i].center.data()), 3 * sizeof(::rl::math::Real));
+					file.write(reinterpret_cast<const char*>(&this->spheres[i].radius), sizeof(::rl::math::Real));
+				}
+				
+				if (!file)
+				{
+					throw Exception("rl::sg::sdf::Field::save() - Failed to write file '" + filename + "'");
+				}
+			}
+		}
+	}
+}
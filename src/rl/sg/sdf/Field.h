@@ -0,0 +1,170 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef RL_SG_SDF_FIELD_H
+#define RL_SG_SDF_FIELD_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <rl/math/Real.h>
+#include <rl/math/Vector.h>
+#include <rl/sg/export.h>
+
+namespace rl
+{
+	namespace sg
+	{
+		namespace sdf
+		{
+			/**
+			 * Signed distance field sampled on a regular grid.
+			 *
+			 * Distances are computed exactly in a narrow band around the
+			 * triangles and propagated to the remaining grid vertices by
+			 * closest point sweeps. The sign is determined by ray parity
+			 * along the x-axis, which requires closed meshes. Queries
+			 * interpolate trilinearly between grid vertices and return a
+			 * conservative lower bound outside of the grid.
+			 *
+			 * In addition, the occupied volume is covered by a set of
+			 * spheres that can be tested against another field.
+			 */
+			class RL_SG_EXPORT Field
+			{
+			public:
+				struct Sphere
+				{
+					::rl::math::Vector3 center;
+					
+					::rl::math::Real radius;
+				};
+				
+				Field();
+				
+				virtual ~Field();
+				
+				/**
+				 * @param[in] vertices Triangle vertices in local coordinates,
+				 * three consecutive entries per triangle
+				 * @param[in] resolution Requested grid spacing, increased if
+				 * the grid would exceed the maximum number of vertices per axis
+				 */
+				void build(const ::std::vector<::rl::math::Vector3>& vertices, const ::rl::math::Real& resolution);
+				
+				/**
+				 * @return Signed distance, negative inside of the mesh
+				 */
+				::rl::math::Real distance(const ::rl::math::Vector3& point) const;
+				
+				/**
+				 * @param[out] gradient Normalized gradient pointing away from the surface
+				 */
+				::rl::math::Real distance(const ::rl::math::Vector3& point, ::rl::math::Vector3& gradient) const;
+				
+				const ::rl::math::Vector3& getCenter() const;
+				
+				::rl::math::Real getRadius() const;
+				
+				::rl::math::Real getResolution() const;
+				
+				const ::std::array<::std::size_t, 3>& getSize() const;
+				
+				const ::std::vector<Sphere>& getSpheres() const;
+				
+				/**
+				 * Computes a 64-bit FNV-1a hash over triangle vertices and
+				 * resolution, used as key for cached fields.
+				 */
+				static ::std::uint64_t hash(const ::std::vector<::rl::math::Vector3>& vertices, const ::rl::math::Real& resolution);
+				
+				/**
+				 * Load field saved with save().
+				 *
+				 * @return false if the file cannot be opened or was saved with a
+				 * different key or floating point type
+				 */
+				bool load(const ::std::string& filename, const ::std::uint64_t& key);
+				
+				/**
+				 * Save grid, values, and spheres in host byte order.
+				 *
+				 * @param[in] key Identifies the geometry, e.g., from hash()
+				 */
+				void save(const ::std::string& filename, const ::std::uint64_t& key) const;
+				
+				static const ::std::size_t maximum;
+				
+			protected:
+				
+			private:
+				struct FileHeader
+				{
+					char magic[4];
+					
+					::std::uint32_t version;
+					
+					::std::uint64_t key;
+					
+					::std::uint64_t size[3];
+					
+					::std::uint64_t spheres;
+					
+					::std::uint32_t real;
+					
+					::std::uint32_t reserved;
+				};
+				
+				static ::rl::math::Vector3 closestPoint(const ::rl::math::Vector3& point, const ::rl::math::Vector3& a, const ::rl::math::Vector3& b, const ::rl::math::Vector3& c);
+				
+				void cover();
+				
+				::std::size_t index(const ::std::size_t& x, const ::std::size_t& y, const ::std::size_t& z) const;
+				
+				::rl::math::Vector3 position(const ::std::size_t& x, const ::std::size_t& y, const ::std::size_t& z) const;
+				
+				void propagate(::std::vector<::rl::math::Vector3>& closest, ::std::vector<bool>& valid, const bool& forward);
+				
+				::rl::math::Vector3 center;
+				
+				::rl::math::Vector3 origin;
+				
+				::rl::math::Real radius;
+				
+				::rl::math::Real resolution;
+				
+				::std::array<::std::size_t, 3> size;
+				
+				::std::vector<Sphere> spheres;
+				
+				::std::vector<float> values;
+			};
+		}
+	}
+}
+
+#endif // RL_SG_SDF_FIELD_H
@@ -0,0 +1,205 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <algorithm>
+#include <limits>
+
+#include "Model.h"
+#include "Scene.h"
+#include "Shape.h"
+
+namespace rl
+{
+	namespace sg
+	{
+		namespace sdf
+		{
+			Scene::Scene() :
+				::rl::sg::Scene(),
+				::rl::sg::DistanceScene(),
+				::rl::sg::SimpleScene(),
+				cacheDirectory(),
+				resolution(static_cast<::rl::math::Real>(0.01))
+			{
+			}
+			
+			Scene::~Scene()
+			{
+				while (this->models.size() > 0)
+				{
+					delete this->models[0];
+				}
+			}
+			
+			bool
+			Scene::areColliding(::rl::sg::Shape* first, ::rl::sg::Shape* second)
+			{
+				Shape* shape1 = static_cast<Shape*>(first);
+				Shape* shape2 = static_cast<Shape*>(second);
+				
+				::rl::math::Vector3 center1 = shape1->getFrame() * shape1->getField().getCenter();
+				::rl::math::Vector3 center2 = shape2->getFrame() * shape2->getField().getCenter();
+				
+				if ((center1 - center2).norm() > shape1->getField().getRadius() + shape2->getField().getRadius())
+				{
+					return false;
+				}
+				
+				// look up spheres of the shape with fewer spheres in the field of the other
+				
+				if (shape1->getField().getSpheres().size() > shape2->getField().getSpheres().size())
+				{
+					::std::swap(shape1, shape2);
+					::std::swap(center1, center2);
+				}
+				
+				const ::std::vector<Field::Sphere>& spheres = shape1->getField().getSpheres();
+				
+				for (::std::size_t i = 0; i < spheres.size(); ++i)
+				{
+					::rl::math::Vector3 center = shape1->getFrame() * spheres[i].center;
+					
+					if ((center - center2).norm() - spheres[i].radius > shape2->getField().getRadius())
+					{
+						continue;
+					}
+					
+					if (shape2->distance(center) < spheres[i].radius)
+					{
+						return true;
+					}
+				}
+				
+				return false;
+			}
+			
+			::rl::sg::Model*
+			Scene::create()
+			{
+				return new Model(this);
+			}
+			
+			::rl::math::Real
+			Scene::distance(::rl::sg::Shape* first, ::rl::sg::Shape* second, ::rl::math::Vector3& point1, ::rl::math::Vector3& point2)
+			{
+				Shape* shape1 = static_cast<Shape*>(first);
+				Shape* shape2 = static_cast<Shape*>(second);
+				::rl::math::Vector3* witness1 = &point1;
+				::rl::math::Vector3* witness2 = &point2;
+				
+				if (shape1->getField().getSpheres().size() > shape2->getField().getSpheres().size())
+				{
+					::std::swap(shape1, shape2);
+					::std::swap(witness1, witness2);
+				}
+				
+				::rl::math::Vector3 center2 = shape2->getFrame() * shape2->getField().getCenter();
+				::rl::math::Real distance = ::std::numeric_limits<::rl::math::Real>::infinity();
+				::std::size_t closest = 0;
+				
+				const ::std::vector<Field::Sphere>& spheres = shape1->getField().getSpheres();
+				
+				for (::std::size_t i = 0; i < spheres.size(); ++i)
+				{
+					::rl::math::Vector3 center = shape1->getFrame() * spheres[i].center;
+					
+					// skip spheres that cannot be closer than the current minimum
+					
+					if ((center - center2).norm() - shape2->getField().getRadius() - spheres[i].radius >= distance)
+					{
+						continue;
+					}
+					
+					::rl::math::Real d = shape2->distance(center) - spheres[i].radius;
+					
+					if (d < distance)
+					{
+						distance = d;
+						closest = i;
+					}
+				}
+				
+				if (spheres.empty())
+				{
+					return distance;
+				}
+				
+				::rl::math::Vector3 center = shape1->getFrame() * spheres[closest].center;
+				::rl::math::Vector3 gradient;
+				shape2->distance(center, gradient);
+				
+				*witness1 = center - spheres[closest].radius * gradient;
+				*witness2 = center - (distance + spheres[closest].radius) * gradient;
+				
+				return ::std::max(distance, static_cast<::rl::math::Real>(0));
+			}
+			
+			::rl::math::Real
+			Scene::distance(::rl::sg::Shape* shape, const ::rl::math::Vector3& point, ::rl::math::Vector3& point1, ::rl::math::Vector3& point2)
+			{
+				Shape* shape1 = static_cast<Shape*>(shape);
+				
+				::rl::math::Vector3 gradient;
+				::rl::math::Real distance = shape1->distance(point, gradient);
+				
+				point1 = point - distance * gradient;
+				point2 = point;
+				
+				return ::std::max(distance, static_cast<::rl::math::Real>(0));
+			}
+			
+			const ::std::string&
+			Scene::getCacheDirectory() const
+			{
+				return this->cacheDirectory;
+			}
+			
+			::rl::math::Real
+			Scene::getResolution() const
+			{
+				return this->resolution;
+			}
+			
+			bool
+			Scene::isScalingSupported() const
+			{
+				return false;
+			}
+			
+			void
+			Scene::setCacheDirectory(const ::std::string& cacheDirectory)
+			{
+				this->cacheDirectory = cacheDirectory;
+			}
+			
+			void
+			Scene::setResolution(const ::rl::math::Real& resolution)
+			{
+				this->resolution = resolution;
+			}
+		}
+	}
+}
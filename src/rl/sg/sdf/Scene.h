@@ -0,0 +1,105 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef RL_SG_SDF_SCENE_H
+#define RL_SG_SDF_SCENE_H
+
+#include <string>
+
+#include "../DistanceScene.h"
+#include "../SimpleScene.h"
+
+namespace rl
+{
+	namespace sg
+	{
+		/**
+		 * Signed distance fields.
+		 *
+		 * Every shape is sampled into a signed distance field on a regular grid
+		 * when it is loaded and covered by a set of spheres. Two shapes are
+		 * tested by looking up the sphere centers of the shape with fewer
+		 * spheres in the field of the other, at constant cost per sphere
+		 * independent of the number of triangles. As the spheres enclose the
+		 * geometry with a margin of up to one cell diagonal, collision checks
+		 * are conservative and distances are lower bounds, both converging with
+		 * finer resolution. Fields can be cached on disk to avoid sampling on
+		 * every start. Meshes need to be closed for the sign to be correct.
+		 */
+		namespace sdf
+		{
+			class RL_SG_EXPORT Scene : public ::rl::sg::DistanceScene, public ::rl::sg::SimpleScene
+			{
+			public:
+				Scene();
+				
+				virtual ~Scene();
+				
+				using ::rl::sg::SimpleScene::areColliding;
+				
+				bool areColliding(::rl::sg::Shape* first, ::rl::sg::Shape* second);
+				
+				::rl::sg::Model* create();
+				
+				using ::rl::sg::DistanceScene::distance;
+				
+				::rl::math::Real distance(::rl::sg::Shape* first, ::rl::sg::Shape* second, ::rl::math::Vector3& point1, ::rl::math::Vector3& point2);
+				
+				::rl::math::Real distance(::rl::sg::Shape* shape, const ::rl::math::Vector3& point, ::rl::math::Vector3& point1, ::rl::math::Vector3& point2);
+				
+				const ::std::string& getCacheDirectory() const;
+				
+				::rl::math::Real getResolution() const;
+				
+				bool isScalingSupported() const;
+				
+				/**
+				 * Directory for storing and loading fields, disabled if empty.
+				 *
+				 * Fields are identified by a hash of their triangles and
+				 * resolution. Only affects shapes loaded afterwards.
+				 */
+				void setCacheDirectory(const ::std::string& cacheDirectory);
+				
+				/**
+				 * Grid spacing of fields, defaults to 0.01.
+				 *
+				 * Only affects shapes loaded afterwards.
+				 */
+				void setResolution(const ::rl::math::Real& resolution);
+				
+			protected:
+				
+			private:
+				::std::string cacheDirectory;
+				
+				::rl::math::Real resolution;
+			};
+		}
+	}
+}
+
+#endif // RL_SG_SDF_SCENE_H
@@ -0,0 +1,146 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <iomanip>
+#include <sstream>
+#include <Inventor/SoPrimitiveVertex.h>
+#include <Inventor/VRMLnodes/SoVRMLGeometry.h>
+
+#include "Body.h"
+#include "Model.h"
+#include "Scene.h"
+#include "Shape.h"
+
+namespace rl
+{
+	namespace sg
+	{
+		namespace sdf
+		{
+			Shape::Shape(::SoVRMLShape* shape, Body* body) :
+				::rl::sg::Shape(body),
+				field(),
+				frame(::rl::math::Transform::Identity()),
+				inverse(::rl::math::Transform::Identity()),
+				transform(::rl::math::Transform::Identity())
+			{
+				::SoVRMLGeometry* geometry = static_cast<::SoVRMLGeometry*>(shape->geometry.getValue());
+				
+				::std::vector<::rl::math::Vector3> vertices;
+				
+				::SoCallbackAction callbackAction;
+				callbackAction.addTriangleCallback(geometry->getTypeId(), Shape::triangleCallback, &vertices);
+				callbackAction.apply(geometry);
+				
+				Scene* scene = dynamic_cast<Scene*>(this->getBody()->getModel()->getScene());
+				
+				if (scene->getCacheDirectory().empty())
+				{
+					this->field.build(vertices, scene->getResolution());
+				}
+				else
+				{
+					::std::uint64_t key = Field::hash(vertices, scene->getResolution());
+					
+					::std::ostringstream filename;
+					filename << scene->getCacheDirectory() << "/" << ::std::hex << ::std::setfill('0') << ::std::setw(16) << key << ".sdf";
+					
+					if (!this->field.load(filename.str(), key))
+					{
+						this->field.build(vertices, scene->getResolution());
+						this->field.save(filename.str(), key);
+					}
+				}
+				
+				this->getBody()->add(this);
+			}
+			
+			Shape::~Shape()
+			{
+				this->getBody()->remove(this);
+			}
+			
+			::rl::math::Real
+			Shape::distance(const ::rl::math::Vector3& point) const
+			{
+				return this->field.distance(this->inverse * point);
+			}
+			
+			::rl::math::Real
+			Shape::distance(const ::rl::math::Vector3& point, ::rl::math::Vector3& gradient) const
+			{
+				::rl::math::Real distance = this->field.distance(this->inverse * point, gradient);
+				gradient = this->frame.linear() * gradient;
+				return distance;
+			}
+			
+			const Field&
+			Shape::getField() const
+			{
+				return this->field;
+			}
+			
+			const ::rl::math::Transform&
+			Shape::getFrame() const
+			{
+				return this->frame;
+			}
+			
+			::rl::math::Transform
+			Shape::getTransform() const
+			{
+				return this->transform;
+			}
+			
+			void
+			Shape::setTransform(const ::rl::math::Transform& transform)
+			{
+				this->transform = transform;
+				
+				this->update();
+				
+				this->getBody()->getModel()->getScene()->increaseRevision();
+			}
+			
+			void
+			Shape::triangleCallback(void* userData, ::SoCallbackAction* action, const ::SoPrimitiveVertex* v1, const ::SoPrimitiveVertex* v2, const ::SoPrimitiveVertex* v3)
+			{
+				::std::vector<::rl::math::Vector3>* vertices = static_cast<::std::vector<::rl::math::Vector3>*>(userData);
+				
+				vertices->push_back(::rl::math::Vector3(v1->getPoint()[0], v1->getPoint()[1], v1->getPoint()[2]));
+				vertices->push_back(::rl::math::Vector3(v2->getPoint()[0], v2->getPoint()[1], v2->getPoint()[2]));
+				vertices->push_back(::rl::math::Vector3(v3->getPoint()[0], v3->getPoint()[1], v3->getPoint()[2]));
+			}
+			
+			void
+			Shape::update()
+			{
+				this->frame = static_cast<Body*>(this->getBody())->frame * this->transform;
+				this->inverse = this->frame.inverse(::Eigen::Isometry);
+			}
+		}
+	}
+}
@@ -0,0 +1,96 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef RL_SG_SDF_SHAPE_H
+#define RL_SG_SDF_SHAPE_H
+
+#include <vector>
+#include <Inventor/actions/SoCallbackAction.h>
+#include <Inventor/VRMLnodes/SoVRMLShape.h>
+
+#include "../Shape.h"
+#include "Field.h"
+
+namespace rl
+{
+	namespace sg
+	{
+		namespace sdf
+		{
+			class RL_SG_EXPORT Shape : public ::rl::sg::Shape
+			{
+			public:
+				EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+				
+				/**
+				 * Builds the field with the resolution of the scene or loads it
+				 * from the cache directory of the scene if available.
+				 */
+				Shape(::SoVRMLShape* shape, Body* body);
+				
+				virtual ~Shape();
+				
+				/**
+				 * @param[in] point Point in world coordinates
+				 */
+				::rl::math::Real distance(const ::rl::math::Vector3& point) const;
+				
+				/**
+				 * @param[in] point Point in world coordinates
+				 * @param[out] gradient Gradient in world coordinates
+				 */
+				::rl::math::Real distance(const ::rl::math::Vector3& point, ::rl::math::Vector3& gradient) const;
+				
+				const Field& getField() const;
+				
+				const ::rl::math::Transform& getFrame() const;
+				
+				using ::rl::sg::Shape::getTransform;
+				
+				::rl::math::Transform getTransform() const;
+				
+				void setTransform(const ::rl::math::Transform& transform);
+				
+				void update();
+				
+			protected:
+				
+			private:
+				static void triangleCallback(void* userData, ::SoCallbackAction* action, const ::SoPrimitiveVertex* v1, const ::SoPrimitiveVertex* v2, const ::SoPrimitiveVertex* v3);
+				
+				Field field;
+				
+				::rl::math::Transform frame;
+				
+				::rl::math::Transform inverse;
+				
+				::rl::math::Transform transform;
+			};
+		}
+	}
+}
+
+#endif // RL_SG_SDF_SHAPE_H
@@ -128,6 +128,8 @@ namespace rl
 				}
 				
 				this->root->setMatrix(matrix);
+				
+				this->getModel()->increaseRevision();
 			}
 			
 			void
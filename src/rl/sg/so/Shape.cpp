@@ -29,6 +29,7 @@
 #include <Inventor/actions/SoSearchAction.h>
 
 #include "Body.h"
+#include "Model.h"
 #include "Scene.h"
 #include "Shape.h"
 
@@ -110,6 +111,8 @@ namespace rl
 				}
 				
 				this->root->setMatrix(matrix);
+				
+				this->getBody()->getModel()->getScene()->increaseRevision();
 			}
 		}
 	}
@@ -218,6 +218,8 @@ namespace rl
 				this->transform = transform;
 				
 				this->update();
+				
+				this->getBody()->getModel()->getScene()->increaseRevision();
 			}
 			
 			void
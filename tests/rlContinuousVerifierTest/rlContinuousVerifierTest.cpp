@@ -0,0 +1,201 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <boost/lexical_cast.hpp>
+#include <rl/math/Constants.h>
+#include <rl/mdl/Kinematic.h>
+#include <rl/mdl/XmlFactory.h>
+#include <rl/plan/ContinuousVerifier.h>
+#include <rl/plan/DistanceModel.h>
+#include <rl/plan/RecursiveVerifier.h>
+#include <rl/sg/Model.h>
+#include <rl/sg/XmlFactory.h>
+
+#ifdef RL_SG_BULLET
+#include <rl/sg/bullet/Scene.h>
+#endif // RL_SG_BULLET
+#ifdef RL_SG_FCL
+#include <rl/sg/fcl/Scene.h>
+#endif // RL_SG_FCL
+#ifdef RL_SG_PQP
+#include <rl/sg/pqp/Scene.h>
+#endif // RL_SG_PQP
+#ifdef RL_SG_SDF
+#include <rl/sg/sdf/Scene.h>
+#endif // RL_SG_SDF
+#ifdef RL_SG_SOLID
+#include <rl/sg/solid/Scene.h>
+#endif // RL_SG_SOLID
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 11)
+	{
+		std::cout << "Usage: rlContinuousVerifierTest ENGINE SCENEFILE KINEMATICSFILE X Y Z A B C COLLIDING START1 ... STARTn GOAL1 ... GOALn" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	try
+	{
+		std::shared_ptr<rl::sg::Scene> scene;
+		
+#ifdef RL_SG_BULLET
+		if ("bullet" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::bullet::Scene>();
+		}
+#endif // RL_SG_BULLET
+#ifdef RL_SG_FCL
+		if ("fcl" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::fcl::Scene>();
+		}
+#endif // RL_SG_FCL
+#ifdef RL_SG_PQP
+		if ("pqp" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::pqp::Scene>();
+		}
+#endif // RL_SG_PQP
+#ifdef RL_SG_SDF
+		if ("sdf" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::sdf::Scene>();
+		}
+#endif // RL_SG_SDF
+#ifdef RL_SG_SOLID
+		if ("solid" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::solid::Scene>();
+		}
+#endif // RL_SG_SOLID
+		
+		rl::sg::XmlFactory factory1;
+		factory1.load(argv[2], scene.get());
+		
+		rl::mdl::XmlFactory factory2;
+		std::shared_ptr<rl::mdl::Kinematic> kinematic = std::dynamic_pointer_cast<rl::mdl::Kinematic>(factory2.create(argv[3]));
+		
+		rl::math::Transform world = rl::math::Transform::Identity();
+		
+		world = rl::math::AngleAxis(
+			boost::lexical_cast<rl::math::Real>(argv[9]) * rl::math::constants::deg2rad,
+			rl::math::Vector3::UnitZ()
+		) * rl::math::AngleAxis(
+			boost::lexical_cast<rl::math::Real>(argv[8]) * rl::math::constants::deg2rad,
+			rl::math::Vector3::UnitY()
+		) * rl::math::AngleAxis(
+			boost::lexical_cast<rl::math::Real>(argv[7]) * rl::math::constants::deg2rad,
+			rl::math::Vector3::UnitX()
+		);
+		
+		world.translation().x() = boost::lexical_cast<rl::math::Real>(argv[4]);
+		world.translation().y() = boost::lexical_cast<rl::math::Real>(argv[5]);
+		world.translation().z() = boost::lexical_cast<rl::math::Real>(argv[6]);
+		
+		kinematic->world() = world;
+		
+		bool colliding = boost::lexical_cast<bool>(argv[10]);
+		
+		Eigen::Matrix<rl::math::Units, Eigen::Dynamic, 1> qUnits = kinematic->getPositionUnits();
+		
+		rl::math::Vector start(kinematic->getDofPosition());
+		rl::math::Vector goal(kinematic->getDofPosition());
+		
+		if (argc < 11 + 2 * start.size())
+		{
+			std::cerr << "Expected " << start.size() << " values for start and goal." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		for (std::ptrdiff_t i = 0; i < start.size(); ++i)
+		{
+			start(i) = boost::lexical_cast<rl::math::Real>(argv[i + 11]);
+			goal(i) = boost::lexical_cast<rl::math::Real>(argv[start.size() + i + 11]);
+			
+			if (rl::math::Units::radian == qUnits(i))
+			{
+				start(i) *= rl::math::constants::deg2rad;
+				goal(i) *= rl::math::constants::deg2rad;
+			}
+		}
+		
+		rl::plan::DistanceModel model;
+		model.mdl = kinematic.get();
+		model.model = scene->getModel(0);
+		model.scene = scene.get();
+		
+		if (model.isColliding(start) || model.isColliding(goal))
+		{
+			std::cerr << "Start and goal need to be free." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		rl::plan::RecursiveVerifier recursiveVerifier;
+		recursiveVerifier.setDelta(1 * rl::math::constants::deg2rad);
+		recursiveVerifier.setModel(&model);
+		
+		model.reset();
+		bool recursive = recursiveVerifier.isColliding(start, goal, model.distance(start, goal));
+		std::size_t recursiveQueries = model.getTotalQueries();
+		
+		rl::plan::ContinuousVerifier continuousVerifier;
+		continuousVerifier.setDelta(1 * rl::math::constants::deg2rad);
+		continuousVerifier.setModel(&model);
+		
+		model.reset();
+		bool continuous = continuousVerifier.isColliding(start, goal, model.distance(start, goal));
+		std::size_t continuousQueries = model.getTotalQueries();
+		
+		std::cout << "RecursiveVerifier: " << (recursive ? "colliding" : "free") << " with " << recursiveQueries << " queries" << std::endl;
+		std::cout << "ContinuousVerifier: " << (continuous ? "colliding" : "free") << " with " << continuousQueries << " queries" << std::endl;
+		
+		if (colliding != recursive || colliding != continuous)
+		{
+			std::cerr << "Segment is expected to be " << (colliding ? "colliding" : "free") << "." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		// certifying subsegments by distance needs bounding boxes of bodies
+		
+		if (!colliding && continuousQueries >= recursiveQueries)
+		{
+			std::cerr << "ContinuousVerifier did not certify any subsegment." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		return EXIT_SUCCESS;
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+}
@@ -0,0 +1,208 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <rl/mdl/Data.h>
+#include <rl/mdl/Dynamic.h>
+#include <rl/mdl/XmlFactory.h>
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		std::cout << "Usage: rlDataMdlTest MODELFILE" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	try
+	{
+		rl::mdl::XmlFactory factory;
+		std::shared_ptr<rl::mdl::Dynamic> dynamic = std::dynamic_pointer_cast<rl::mdl::Dynamic>(factory.create(argv[1]));
+		
+		std::mt19937 randEngine(0);
+		std::uniform_real_distribution<rl::math::Real> randDistribution(-1, 1);
+		
+		std::size_t loop = 100;
+		
+		std::vector<rl::math::Vector> q(loop);
+		std::vector<rl::math::Vector> qd(loop);
+		std::vector<rl::math::Vector> qdd(loop);
+		std::vector<rl::math::Vector> tau(loop);
+		
+		for (std::size_t i = 0; i < loop; ++i)
+		{
+			rl::math::Vector rand(dynamic->getDofPosition());
+			
+			for (std::size_t j = 0; j < dynamic->getDofPosition(); ++j)
+			{
+				rand(j) = (randDistribution(randEngine) + 1) / 2;
+			}
+			
+			q[i] = dynamic->generatePositionUniform(rand);
+			qd[i] = rl::math::Vector(dynamic->getDof());
+			qdd[i] = rl::math::Vector(dynamic->getDof());
+			
+			for (std::size_t j = 0; j < dynamic->getDof(); ++j)
+			{
+				qd[i](j) = randDistribution(randEngine);
+				qdd[i](j) = randDistribution(randEngine);
+			}
+		}
+		
+		rl::mdl::Data data(*dynamic);
+		
+		for (std::size_t i = 0; i < loop; ++i)
+		{
+			dynamic->setPosition(q[i]);
+			dynamic->setVelocity(qd[i]);
+			dynamic->setAcceleration(qdd[i]);
+			dynamic->forwardPosition();
+			dynamic->forwardVelocity();
+			dynamic->forwardAcceleration();
+			dynamic->calculateJacobian();
+			
+			data.q = q[i];
+			data.qd = qd[i];
+			data.qdd = qdd[i];
+			dynamic->forwardPosition(data);
+			dynamic->forwardVelocity(data);
+			dynamic->forwardAcceleration(data);
+			dynamic->calculateJacobian(data);
+			
+			for (std::size_t j = 0; j < dynamic->getOperationalDof(); ++j)
+			{
+				if (!dynamic->getOperationalPosition(data, j).isApprox(dynamic->getOperationalPosition(j)))
+				{
+					std::cerr << "getOperationalPosition(Data) differs from getOperationalPosition()" << std::endl;
+					std::cerr << "q: " << q[i].transpose() << std::endl;
+					return EXIT_FAILURE;
+				}
+				
+				if (!dynamic->getOperationalVelocity(data, j).matrix().isApprox(dynamic->getOperationalVelocity(j).matrix()))
+				{
+					std::cerr << "getOperationalVelocity(Data) differs from getOperationalVelocity()" << std::endl;
+					std::cerr << "q: " << q[i].transpose() << std::endl;
+					return EXIT_FAILURE;
+				}
+				
+				if (!dynamic->getOperationalAcceleration(data, j).matrix().isApprox(dynamic->getOperationalAcceleration(j).matrix()))
+				{
+					std::cerr << "getOperationalAcceleration(Data) differs from getOperationalAcceleration()" << std::endl;
+					std::cerr << "q: " << q[i].transpose() << std::endl;
+					return EXIT_FAILURE;
+				}
+			}
+			
+			if (!data.J.isApprox(dynamic->getJacobian()))
+			{
+				std::cerr << "calculateJacobian(Data) differs from calculateJacobian()" << std::endl;
+				std::cerr << "q: " << q[i].transpose() << std::endl;
+				return EXIT_FAILURE;
+			}
+			
+			dynamic->inverseDynamics();
+			dynamic->inverseDynamics(data);
+			
+			if (!data.tau.isApprox(dynamic->getTorque()))
+			{
+				std::cerr << "inverseDynamics(Data) differs from inverseDynamics()" << std::endl;
+				std::cerr << "q: " << q[i].transpose() << std::endl;
+				std::cerr << "tau: " << dynamic->getTorque().transpose() << std::endl;
+				std::cerr << "tau(Data): " << data.tau.transpose() << std::endl;
+				return EXIT_FAILURE;
+			}
+			
+			tau[i] = data.tau;
+			
+			dynamic->forwardDynamics();
+			dynamic->forwardDynamics(data);
+			
+			if (!data.qdd.isApprox(dynamic->getAcceleration(), 1.0e-6) || !data.qdd.isApprox(qdd[i], 1.0e-6))
+			{
+				std::cerr << "forwardDynamics(Data) differs from forwardDynamics()" << std::endl;
+				std::cerr << "q: " << q[i].transpose() << std::endl;
+				std::cerr << "qdd: " << dynamic->getAcceleration().transpose() << std::endl;
+				std::cerr << "qdd(Data): " << data.qdd.transpose() << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+		
+		std::size_t threads = std::max(std::thread::hardware_concurrency(), 2u);
+		std::vector<std::thread> workers;
+		std::vector<std::size_t> errors(threads, 0);
+		
+		for (std::size_t t = 0; t < threads; ++t)
+		{
+			workers.emplace_back([&, t]()
+			{
+				rl::mdl::Data data(*dynamic);
+				
+				for (std::size_t n = 0; n < 10; ++n)
+				{
+					for (std::size_t i = t; i < loop; i += threads)
+					{
+						data.q = q[i];
+						data.qd = qd[i];
+						data.qdd = qdd[i];
+						dynamic->forwardPosition(data);
+						dynamic->inverseDynamics(data);
+						
+						if (!data.tau.isApprox(tau[i]))
+						{
+							++errors[t];
+						}
+					}
+				}
+			});
+		}
+		
+		for (std::size_t t = 0; t < threads; ++t)
+		{
+			workers[t].join();
+			
+			if (errors[t] > 0)
+			{
+				std::cerr << "inverseDynamics(Data) differs in thread " << t << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+	}
+	catch (const std::exception& e)
+	{
+		std::cerr << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	return EXIT_SUCCESS;
+}
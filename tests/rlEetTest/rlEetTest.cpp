@@ -57,7 +57,7 @@ main(int argc, char** argv)
 {
 	if (argc < 6)
 	{
-		std::cout << "Usage: rlEetTest ENGINE SCENEFILE KINEMATICSFILE EXPECTED_NUM_VERTICES_MAX EXPECTED_NUM_EDGES_MAX START1 ... STARTn GOAL1 ... GOALn" << std::endl;
+		std::cout << "Usage: rlEetTest ENGINE SCENEFILE KINEMATICSFILE EXPECTED_NUM_VERTICES_MAX EXPECTED_NUM_EDGES_MAX START1 ... STARTn GOAL1 ... GOALn [CACHE_RESOLUTION]" << std::endl;
 		return EXIT_FAILURE;
 	}
 	
@@ -127,6 +127,11 @@ main(int argc, char** argv)
 		model.model = scene->getModel(0);
 		model.scene = scene.get();
 		
+		if (argc > 2 * start.size() + 6)
+		{
+			model.setCacheResolution(boost::lexical_cast<rl::math::Real>(argv[2 * start.size() + 6]));
+		}
+		
 		rl::plan::WorkspaceSphereExplorer explorer;
 		rl::plan::Eet::ExplorerSetup explorerSetup;
 		rl::plan::LinearNearestNeighbors nearestNeighbors(&model);
@@ -191,6 +196,17 @@ main(int argc, char** argv)
 		
 		std::cout << "NumVertices: " << planner.getNumVertices() << "  NumEdges: " << planner.getNumEdges() << std::endl;
 		
+		if (model.getCacheResolution() > 0)
+		{
+			std::cout << "CacheHits: " << model.getCacheHits() << "  CacheSize: " << model.getCacheSize() << std::endl;
+			
+			if (0 == model.getCacheHits())
+			{
+				std::cerr << "Distance cache was not used." << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+		
 		if (solved)
 		{
 			if (boost::lexical_cast<std::size_t>(argv[4]) >= planner.getNumVertices() &&
@@ -0,0 +1,131 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <boost/lexical_cast.hpp>
+#include <rl/mdl/Kinematic.h>
+#include <rl/mdl/XmlFactory.h>
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 3)
+	{
+		std::cout << "Usage: rlForwardPositionMdlTest MODELFILE LOOP" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	try
+	{
+		rl::mdl::XmlFactory factory;
+		std::shared_ptr<rl::mdl::Kinematic> kinematic = std::dynamic_pointer_cast<rl::mdl::Kinematic>(factory.create(argv[1]));
+		
+		std::size_t loop = boost::lexical_cast<std::size_t>(argv[2]);
+		
+		std::mt19937 randEngine(0);
+		std::uniform_real_distribution<rl::math::Real> randDistribution(0, 1);
+		
+		rl::math::Matrix q(kinematic->getDofPosition(), loop);
+		
+		for (std::size_t i = 0; i < loop; ++i)
+		{
+			rl::math::Vector rand(kinematic->getDofPosition());
+			
+			for (std::size_t j = 0; j < kinematic->getDofPosition(); ++j)
+			{
+				rand(j) = randDistribution(randEngine);
+			}
+			
+			q.col(i) = kinematic->generatePositionUniform(rand);
+		}
+		
+		rl::math::Matrix operational(loop, 12 * kinematic->getOperationalDof());
+		rl::math::Matrix bodies(loop, 12 * kinematic->getBodies());
+		
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		
+		for (std::size_t i = 0; i < loop; ++i)
+		{
+			kinematic->setPosition(q.col(i));
+			kinematic->forwardPosition();
+			
+			for (std::size_t j = 0; j < kinematic->getOperationalDof(); ++j)
+			{
+				for (std::size_t k = 0; k < 12; ++k)
+				{
+					operational(i, 12 * j + k) = kinematic->getOperationalPosition(j).matrix()(k % 3, k / 3);
+				}
+			}
+			
+			for (std::size_t j = 0; j < kinematic->getBodies(); ++j)
+			{
+				for (std::size_t k = 0; k < 12; ++k)
+				{
+					bodies(i, 12 * j + k) = kinematic->getBodyFrame(j).matrix()(k % 3, k / 3);
+				}
+			}
+		}
+		
+		std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+		
+		std::cout << "forwardPosition (scalar) " << std::chrono::duration<double, std::micro>(stop - start).count() / loop << " us" << std::endl;
+		
+		rl::math::Matrix operationalBatch;
+		rl::math::Matrix bodiesBatch;
+		
+		start = std::chrono::steady_clock::now();
+		
+		kinematic->forwardPosition(q, operationalBatch, bodiesBatch);
+		
+		stop = std::chrono::steady_clock::now();
+		
+		std::cout << "forwardPosition (batch) " << std::chrono::duration<double, std::micro>(stop - start).count() / loop << " us" << std::endl;
+		
+		if (!operationalBatch.isApprox(operational))
+		{
+			std::cerr << "forwardPosition (batch) operational frames differ from forwardPosition (scalar)" << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		if (!bodiesBatch.isApprox(bodies))
+		{
+			std::cerr << "forwardPosition (batch) body frames differ from forwardPosition (scalar)" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	catch (const std::exception& e)
+	{
+		std::cerr << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	return EXIT_SUCCESS;
+}
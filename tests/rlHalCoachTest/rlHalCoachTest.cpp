@@ -0,0 +1,125 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <iostream>
+#include <vector>
+#include <rl/hal/Coach.h>
+#include <rl/hal/DeviceException.h>
+
+int
+main(int argc, char** argv)
+{
+	rl::math::Vector q(3);
+	q << 0.5, -1.25, 3.0e-7;
+	rl::math::Vector t(6);
+	t << 1, 2, 3, 0.1, 0.2, 0.3;
+	
+	std::vector<std::uint8_t> payload;
+	rl::hal::Coach::encode(2, 1, 0, 0, q, payload);
+	rl::hal::Coach::encode(1, 0, 2, 3, t, payload);
+	rl::hal::Coach::encode(6, 1, 0, 0, rl::math::Vector(), payload);
+	
+	std::vector<std::uint8_t> frame;
+	rl::hal::Coach::encode(3, payload, frame);
+	
+	if (12 + 3 * 12 + (3 + 6) * 8 != frame.size() || 'R' != frame[0] || 'L' != frame[1] || 'C' != frame[2] || 'B' != frame[3])
+	{
+		std::cerr << "Binary frame has wrong layout" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	// round trip with trailing bytes of next frame
+	
+	std::vector<std::uint8_t> buffer(frame);
+	buffer.insert(buffer.end(), frame.begin(), frame.begin() + 5);
+	
+	std::vector<rl::hal::Coach::Command> commands;
+	
+	if (frame.size() != rl::hal::Coach::decode(buffer.data(), buffer.size(), commands) || 3 != commands.size())
+	{
+		std::cerr << "Binary frame not decoded" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	if (2 != commands[0].cmd || 1 != commands[0].i || q != commands[0].values)
+	{
+		std::cerr << "Joint positions not decoded" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	if (1 != commands[1].cmd || 0 != commands[1].i || 2 != commands[1].j || 3 != commands[1].k || t != commands[1].values)
+	{
+		std::cerr << "Shape transform not decoded" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	if (6 != commands[2].cmd || 1 != commands[2].i || 0 != commands[2].values.size())
+	{
+		std::cerr << "Joint position request not decoded" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	// incomplete frames
+	
+	for (std::size_t size = 0; size < frame.size(); ++size)
+	{
+		if (0 != rl::hal::Coach::decode(frame.data(), size, commands))
+		{
+			std::cerr << "Incomplete frame of " << size << " bytes decoded" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	
+	// invalid frames
+	
+	std::vector<std::uint8_t> invalid(frame);
+	invalid[0] = 'X';
+	
+	try
+	{
+		rl::hal::Coach::decode(invalid.data(), invalid.size(), commands);
+		std::cerr << "Frame with invalid magic number decoded" << std::endl;
+		return EXIT_FAILURE;
+	}
+	catch (const rl::hal::DeviceException&)
+	{
+	}
+	
+	invalid = frame;
+	invalid[6] = 4;
+	
+	try
+	{
+		rl::hal::Coach::decode(invalid.data(), invalid.size(), commands);
+		std::cerr << "Frame with too many commands decoded" << std::endl;
+		return EXIT_FAILURE;
+	}
+	catch (const rl::hal::DeviceException&)
+	{
+	}
+	
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,220 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <boost/lexical_cast.hpp>
+#include <rl/mdl/Dynamic.h>
+#include <rl/mdl/XmlFactory.h>
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 3)
+	{
+		std::cout << "Usage: rlMassMatrixTest MODELFILE LOOP" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	try
+	{
+		rl::mdl::XmlFactory factory;
+		std::shared_ptr<rl::mdl::Dynamic> dynamic = std::dynamic_pointer_cast<rl::mdl::Dynamic>(factory.create(argv[1]));
+		
+		std::size_t loop = boost::lexical_cast<std::size_t>(argv[2]);
+		
+		std::mt19937 randEngine(0);
+		std::uniform_real_distribution<rl::math::Real> randDistribution(0, 1);
+		
+		std::vector<rl::math::Vector> q(loop);
+		
+		for (std::size_t i = 0; i < loop; ++i)
+		{
+			rl::math::Vector rand(dynamic->getDof());
+			
+			for (std::size_t j = 0; j < dynamic->getDof(); ++j)
+			{
+				rand(j) = randDistribution(randEngine);
+			}
+			
+			q[i] = dynamic->generatePositionUniform(rand);
+		}
+		
+		rl::math::Matrix M(dynamic->getDof(), dynamic->getDof());
+		std::vector<rl::math::Matrix> compositeRigidBody(loop);
+		std::vector<rl::math::Matrix> inverseDynamics(loop);
+		
+		dynamic->setMassMatrixMethod(rl::mdl::Dynamic::MassMatrixMethod::inverseDynamics);
+		
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		
+		for (std::size_t i = 0; i < loop; ++i)
+		{
+			dynamic->setPosition(q[i]);
+			dynamic->calculateMassMatrix(M);
+			inverseDynamics[i] = M;
+		}
+		
+		std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+		
+		std::cout << dynamic->getName() << " (" << dynamic->getDof() << " dof)" << std::endl;
+		std::cout << "calculateMassMatrix (inverseDynamics) " << std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count() * 1000000 / loop << " us" << std::endl;
+		
+		dynamic->setMassMatrixMethod(rl::mdl::Dynamic::MassMatrixMethod::compositeRigidBody);
+		
+		start = std::chrono::steady_clock::now();
+		
+		for (std::size_t i = 0; i < loop; ++i)
+		{
+			dynamic->setPosition(q[i]);
+			dynamic->calculateMassMatrix(M);
+			compositeRigidBody[i] = M;
+		}
+		
+		stop = std::chrono::steady_clock::now();
+		
+		std::cout << "calculateMassMatrix (compositeRigidBody) " << std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count() * 1000000 / loop << " us" << std::endl;
+		
+		for (std::size_t i = 0; i < loop; ++i)
+		{
+			if (!compositeRigidBody[i].isApprox(inverseDynamics[i]))
+			{
+				std::cerr << "q = " << q[i].transpose() << std::endl;
+				std::cerr << "M (inverseDynamics) = " << std::endl << inverseDynamics[i] << std::endl;
+				std::cerr << "M (compositeRigidBody) = " << std::endl << compositeRigidBody[i] << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+		
+		rl::math::Matrix invM(dynamic->getDof(), dynamic->getDof());
+		std::vector<rl::math::Matrix> articulatedBody(loop);
+		std::vector<rl::math::Matrix> forwardDynamics(loop);
+		
+		dynamic->setMassMatrixInverseMethod(rl::mdl::Dynamic::MassMatrixInverseMethod::forwardDynamics);
+		
+		start = std::chrono::steady_clock::now();
+		
+		for (std::size_t i = 0; i < loop; ++i)
+		{
+			dynamic->setPosition(q[i]);
+			dynamic->calculateMassMatrixInverse(invM);
+			forwardDynamics[i] = invM;
+		}
+		
+		stop = std::chrono::steady_clock::now();
+		
+		std::cout << "calculateMassMatrixInverse (forwardDynamics) " << std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count() * 1000000 / loop << " us" << std::endl;
+		
+		dynamic->setMassMatrixInverseMethod(rl::mdl::Dynamic::MassMatrixInverseMethod::articulatedBody);
+		
+		start = std::chrono::steady_clock::now();
+		
+		for (std::size_t i = 0; i < loop; ++i)
+		{
+			dynamic->setPosition(q[i]);
+			dynamic->calculateMassMatrixInverse(invM);
+			articulatedBody[i] = invM;
+		}
+		
+		stop = std::chrono::steady_clock::now();
+		
+		std::cout << "calculateMassMatrixInverse (articulatedBody) " << std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count() * 1000000 / loop << " us" << std::endl;
+		
+		for (std::size_t i = 0; i < loop; ++i)
+		{
+			if (!articulatedBody[i].isApprox(forwardDynamics[i]) || !(compositeRigidBody[i] * articulatedBody[i]).isIdentity(1.0e-6))
+			{
+				std::cerr << "q = " << q[i].transpose() << std::endl;
+				std::cerr << "invM (forwardDynamics) = " << std::endl << forwardDynamics[i] << std::endl;
+				std::cerr << "invM (articulatedBody) = " << std::endl << articulatedBody[i] << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+		
+		rl::math::Matrix J(6 * dynamic->getOperationalDof(), dynamic->getDof());
+		rl::math::Matrix invMx(6 * dynamic->getOperationalDof(), 6 * dynamic->getOperationalDof());
+		
+		for (std::size_t k = 0; k < 2; ++k)
+		{
+			bool inWorldFrame = 0 == k;
+			std::vector<rl::math::Matrix> matrices(loop);
+			std::vector<rl::math::Matrix> recursive(loop);
+			
+			start = std::chrono::steady_clock::now();
+			
+			for (std::size_t i = 0; i < loop; ++i)
+			{
+				dynamic->setPosition(q[i]);
+				dynamic->forwardPosition();
+				dynamic->calculateJacobian(J, inWorldFrame);
+				dynamic->setPosition(q[i]);
+				dynamic->calculateMassMatrixInverse(invM);
+				dynamic->calculateOperationalMassMatrixInverse(J, invM, invMx);
+				matrices[i] = invMx;
+			}
+			
+			stop = std::chrono::steady_clock::now();
+			
+			std::cout << "calculateOperationalMassMatrixInverse (matrices, " << (inWorldFrame ? "world" : "tool") << ") " << std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count() * 1000000 / loop << " us" << std::endl;
+			
+			start = std::chrono::steady_clock::now();
+			
+			for (std::size_t i = 0; i < loop; ++i)
+			{
+				dynamic->setPosition(q[i]);
+				dynamic->forwardPosition();
+				dynamic->calculateOperationalMassMatrixInverse(invMx, inWorldFrame);
+				recursive[i] = invMx;
+			}
+			
+			stop = std::chrono::steady_clock::now();
+			
+			std::cout << "calculateOperationalMassMatrixInverse (recursive, " << (inWorldFrame ? "world" : "tool") << ") " << std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count() * 1000000 / loop << " us" << std::endl;
+			
+			for (std::size_t i = 0; i < loop; ++i)
+			{
+				if (!recursive[i].isApprox(matrices[i], 1.0e-6))
+				{
+					std::cerr << "q = " << q[i].transpose() << std::endl;
+					std::cerr << "invMx (matrices) = " << std::endl << matrices[i] << std::endl;
+					std::cerr << "invMx (recursive) = " << std::endl << recursive[i] << std::endl;
+					return EXIT_FAILURE;
+				}
+			}
+		}
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	return EXIT_SUCCESS;
+}
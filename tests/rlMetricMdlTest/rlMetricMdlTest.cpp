@@ -0,0 +1,135 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <boost/lexical_cast.hpp>
+#include <rl/mdl/Kinematic.h>
+#include <rl/mdl/Revolute.h>
+#include <rl/mdl/XmlFactory.h>
+
+bool
+compare(const std::shared_ptr<rl::mdl::Kinematic>& kinematic, const rl::math::Vector& q1, const rl::math::Matrix& q2, const std::string& name)
+{
+	rl::math::Vector d(q2.cols());
+	
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	
+	for (std::ptrdiff_t i = 0; i < q2.cols(); ++i)
+	{
+		d(i) = kinematic->transformedDistance(q1, q2.col(i));
+	}
+	
+	std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+	
+	std::cout << name << " (scalar) " << std::chrono::duration<double, std::nano>(stop - start).count() / q2.cols() << " ns" << std::endl;
+	
+	rl::math::Vector dBatch;
+	
+	start = std::chrono::steady_clock::now();
+	
+	kinematic->transformedDistance(q1, q2, dBatch);
+	
+	stop = std::chrono::steady_clock::now();
+	
+	std::cout << name << " (batch) " << std::chrono::duration<double, std::nano>(stop - start).count() / q2.cols() << " ns" << std::endl;
+	
+	if (!dBatch.isApprox(d))
+	{
+		std::cerr << name << " (batch) differs from " << name << " (scalar)" << std::endl;
+		return false;
+	}
+	
+	return true;
+}
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 3)
+	{
+		std::cout << "Usage: rlMetricMdlTest MODELFILE LOOP" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	try
+	{
+		rl::mdl::XmlFactory factory;
+		std::shared_ptr<rl::mdl::Kinematic> kinematic = std::dynamic_pointer_cast<rl::mdl::Kinematic>(factory.create(argv[1]));
+		
+		std::size_t loop = boost::lexical_cast<std::size_t>(argv[2]);
+		
+		std::mt19937 randEngine(0);
+		std::uniform_real_distribution<rl::math::Real> randDistribution(0, 1);
+		
+		rl::math::Matrix q(kinematic->getDofPosition(), loop + 1);
+		
+		for (std::size_t i = 0; i < loop + 1; ++i)
+		{
+			rl::math::Vector rand(kinematic->getDofPosition());
+			
+			for (std::size_t j = 0; j < kinematic->getDofPosition(); ++j)
+			{
+				rand(j) = randDistribution(randEngine);
+			}
+			
+			q.col(i) = kinematic->generatePositionUniform(rand);
+		}
+		
+		if (!compare(kinematic, q.col(0), q.rightCols(loop), "transformedDistance"))
+		{
+			return EXIT_FAILURE;
+		}
+		
+		bool wraparound = false;
+		
+		for (std::size_t i = 0; i < kinematic->getJoints(); ++i)
+		{
+			if (nullptr != dynamic_cast<rl::mdl::Revolute*>(kinematic->getJoint(i)))
+			{
+				kinematic->getJoint(i)->setWraparound(Eigen::Matrix<bool, 1, 1>::Constant(true));
+				wraparound = true;
+			}
+		}
+		
+		if (wraparound && !compare(kinematic, q.col(0), q.rightCols(loop), "transformedDistance (wraparound)"))
+		{
+			return EXIT_FAILURE;
+		}
+	}
+	catch (const std::exception& e)
+	{
+		std::cerr << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	return EXIT_SUCCESS;
+}
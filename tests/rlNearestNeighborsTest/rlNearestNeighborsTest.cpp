@@ -1,8 +1,12 @@
 #include <chrono>
+#include <cmath>
 #include <iostream>
+#include <string>
 #include <vector>
+#include <boost/optional.hpp>
 #include <rl/math/GnatNearestNeighbors.h>
 #include <rl/math/KdtreeBoundingBoxNearestNeighbors.h>
+#include <rl/math/KdtreeFlatNearestNeighbors.h>
 #include <rl/math/KdtreeNearestNeighbors.h>
 #include <rl/math/LinearNearestNeighbors.h>
 #include <rl/math/Vector.h>
@@ -16,6 +20,142 @@
 #define N 100000
 #define QUERIES 100
 
+template<typename NearestNeighbors>
+void
+approximate(const std::vector<rl::math::Vector>& points, const std::vector<rl::math::Vector>& queries, const std::vector<std::vector<std::pair<rl::math::Real, const rl::math::Vector*>>>& exact, const rl::math::Real& epsilon, const boost::optional<std::size_t>& checks, const bool& squared)
+{
+	std::vector<const rl::math::Vector*> points2;
+	points2.reserve(points.size());
+	
+	for (std::size_t i = 0; i < points.size(); ++i)
+	{
+		points2.push_back(&points[i]);
+	}
+	
+	NearestNeighbors nearestNeighbors;
+	nearestNeighbors.insert(points2.begin(), points2.end());
+	nearestNeighbors.setChecks(checks);
+	nearestNeighbors.setEpsilon(squared ? std::pow(1 + epsilon, 2) - 1 : epsilon);
+	
+	double time = 0;
+	std::size_t found = 0;
+	std::size_t total = 0;
+	
+	for (std::size_t i = 0; i < queries.size(); ++i)
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		std::vector<typename NearestNeighbors::Neighbor> neighbors = nearestNeighbors.nearest(&queries[i], K);
+		std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+		
+		time += std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count() * 1000;
+		
+		for (std::size_t j = 0; j < exact[i].size(); ++j)
+		{
+			for (std::size_t k = 0; k < neighbors.size(); ++k)
+			{
+				if (exact[i][j].second == neighbors[k].second)
+				{
+					++found;
+					break;
+				}
+			}
+			
+			++total;
+		}
+		
+		if (!checks)
+		{
+			for (std::size_t j = 0; j < neighbors.size(); ++j)
+			{
+				rl::math::Real distance = squared ? std::sqrt(neighbors[j].first) : neighbors[j].first;
+				
+				if (distance > (1 + epsilon) * exact[i][j].first * (1 + 1.0e-9))
+				{
+					std::cerr << "rlNearestNeighborsTest: neighbor [" << i << "][" << j << "] " << distance << " exceeds (1 + " << epsilon << ") * " << exact[i][j].first << std::endl;
+					exit(EXIT_FAILURE);
+				}
+			}
+		}
+	}
+	
+	std::cout << "epsilon " << epsilon << " checks " << (checks ? std::to_string(*checks) : "-") << " recall " << static_cast<double>(found) / total << " average search time " << time / queries.size() << " ms" << std::endl;
+}
+
+void
+approximate(const std::vector<rl::math::Vector>& points, const std::vector<rl::math::Vector>& queries)
+{
+	typedef rl::math::metrics::L2<const rl::math::Vector*> Metric;
+	typedef rl::math::metrics::L2Squared<const rl::math::Vector*> MetricSquared;
+	
+	std::vector<const rl::math::Vector*> points2;
+	points2.reserve(points.size());
+	
+	for (std::size_t i = 0; i < points.size(); ++i)
+	{
+		points2.push_back(&points[i]);
+	}
+	
+	rl::math::LinearNearestNeighbors<Metric> linear(points2.begin(), points2.end());
+	
+	std::vector<std::vector<rl::math::LinearNearestNeighbors<Metric>::Neighbor>> exact;
+	
+	for (std::size_t i = 0; i < queries.size(); ++i)
+	{
+		exact.push_back(linear.nearest(&queries[i], K));
+	}
+	
+	rl::math::Real epsilons[] = {0, 0.1, 0.5, 1};
+	std::size_t checks[] = {100, 1000};
+	
+	std::cout << "** GnatNearestNeighbors<Metric> ***********************************************" << std::endl;
+	
+	for (std::size_t i = 0; i < 4; ++i)
+	{
+		approximate<rl::math::GnatNearestNeighbors<Metric>>(points, queries, exact, epsilons[i], boost::none, false);
+	}
+	
+	for (std::size_t i = 0; i < 2; ++i)
+	{
+		approximate<rl::math::GnatNearestNeighbors<Metric>>(points, queries, exact, 0, checks[i], false);
+	}
+	
+	std::cout << "** KdtreeBoundingBoxNearestNeighbors<MetricSquared> ***************************" << std::endl;
+	
+	for (std::size_t i = 0; i < 4; ++i)
+	{
+		approximate<rl::math::KdtreeBoundingBoxNearestNeighbors<MetricSquared>>(points, queries, exact, epsilons[i], boost::none, true);
+	}
+	
+	for (std::size_t i = 0; i < 2; ++i)
+	{
+		approximate<rl::math::KdtreeBoundingBoxNearestNeighbors<MetricSquared>>(points, queries, exact, 0, checks[i], true);
+	}
+	
+	std::cout << "** KdtreeFlatNearestNeighbors<MetricSquared> **********************************" << std::endl;
+	
+	for (std::size_t i = 0; i < 4; ++i)
+	{
+		approximate<rl::math::KdtreeFlatNearestNeighbors<MetricSquared>>(points, queries, exact, epsilons[i], boost::none, true);
+	}
+	
+	for (std::size_t i = 0; i < 2; ++i)
+	{
+		approximate<rl::math::KdtreeFlatNearestNeighbors<MetricSquared>>(points, queries, exact, 0, checks[i], true);
+	}
+	
+	std::cout << "** KdtreeNearestNeighbors<MetricSquared> **************************************" << std::endl;
+	
+	for (std::size_t i = 0; i < 4; ++i)
+	{
+		approximate<rl::math::KdtreeNearestNeighbors<MetricSquared>>(points, queries, exact, epsilons[i], boost::none, true);
+	}
+	
+	for (std::size_t i = 0; i < 2; ++i)
+	{
+		approximate<rl::math::KdtreeNearestNeighbors<MetricSquared>>(points, queries, exact, 0, checks[i], true);
+	}
+}
+
 template<typename NearestNeighbors>
 std::vector<std::vector<typename NearestNeighbors::Neighbor>>
 test(const std::vector<rl::math::Vector>& points, const std::vector<rl::math::Vector>& queries, const bool& iterative, const bool& squared)
@@ -103,6 +243,9 @@ test(const std::vector<rl::math::Vector>& points, const std::vector<rl::math::Ve
 	std::cout << "** KdtreeBoundingBoxNearestNeighbors<MetricSquared> ***************************" << std::endl;
 	std::vector<std::vector<rl::math::KdtreeBoundingBoxNearestNeighbors<MetricSquared>::Neighbor>> kdtreeBoundingBox = test<rl::math::KdtreeBoundingBoxNearestNeighbors<MetricSquared>>(points, queries, iterative, true);
 	
+	std::cout << "** KdtreeFlatNearestNeighbors<MetricSquared> **********************************" << std::endl;
+	std::vector<std::vector<rl::math::KdtreeFlatNearestNeighbors<MetricSquared>::Neighbor>> kdtreeFlat = test<rl::math::KdtreeFlatNearestNeighbors<MetricSquared>>(points, queries, iterative, true);
+	
 	std::cout << "** KdtreeNearestNeighbors<MetricSquared> **************************************" << std::endl;
 	std::vector<std::vector<rl::math::KdtreeNearestNeighbors<MetricSquared>::Neighbor>> kdtree = test<rl::math::KdtreeNearestNeighbors<MetricSquared>>(points, queries, iterative, true);
 	
@@ -137,6 +280,15 @@ test(const std::vector<rl::math::Vector>& points, const std::vector<rl::math::Ve
 				exit(EXIT_FAILURE);
 			}
 			
+			if (!Eigen::internal::isApprox(linear[i][j].first, std::sqrt(kdtreeFlat[i][j].first)) ||
+				!linear[i][j].second->isApprox(*kdtreeFlat[i][j].second))
+			{
+				std::cerr << "rlNearestNeighborsTest: LinearNearestNeighbors<Metric> != KdtreeFlatNearestNeighbors<MetricSquared>" << std::endl;
+				std::cerr << "[" << i << "][" << j << "] " << linear[i][j].first << " LinearNearestNeighbors<Metric>: " << linear[i][j].second->transpose() << std::endl;
+				std::cerr << "[" << i << "][" << j << "] " << std::sqrt(kdtreeFlat[i][j].first) << " KdtreeFlatNearestNeighbors<MetricSquared>: " << kdtreeFlat[i][j].second->transpose() << std::endl;
+				exit(EXIT_FAILURE);
+			}
+			
 			if (!Eigen::internal::isApprox(linear[i][j].first, std::sqrt(kdtree[i][j].first)) ||
 				!linear[i][j].second->isApprox(*kdtree[i][j].second))
 			{
@@ -202,5 +354,9 @@ main(int argc, char** argv)
 	std::cout << std::endl << "-------------------------------------------------------------------------------" << std::endl << std::endl;
 	test(points, queries, true);
 	
+	std::cout << std::endl << "===============================================================================" << std::endl << std::endl;
+	
+	approximate(points, queries);
+	
 	return EXIT_SUCCESS;
 }
@@ -0,0 +1,291 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <rl/plan/ParallelPlanner.h>
+
+/**
+ * Planner that succeeds or fails after a fixed time without collision checks.
+ *
+ * A planner without result runs until it is canceled or its duration expires.
+ */
+class TimedPlanner : public rl::plan::Planner
+{
+public:
+	TimedPlanner(const std::chrono::steady_clock::duration& delay, const int& result) :
+		Planner(),
+		delay(delay),
+		result(result),
+		solved(false)
+	{
+	}
+	
+	std::string getName() const
+	{
+		return "Timed";
+	}
+	
+	rl::plan::VectorList getPath()
+	{
+		rl::plan::VectorList path;
+		path.push_back(*this->getStart());
+		path.push_back(rl::math::Vector::Constant(this->getStart()->size(), this->result));
+		path.push_back(*this->getGoal());
+		return path;
+	}
+	
+	void reset()
+	{
+		this->solved = false;
+	}
+	
+	bool solve()
+	{
+		this->time = std::chrono::steady_clock::now();
+		
+		while (!this->isCanceled() && (std::chrono::steady_clock::now() - this->time) < this->getDuration())
+		{
+			if (this->result >= 0 && (std::chrono::steady_clock::now() - this->time) >= this->delay)
+			{
+				this->solved = this->result > 0;
+				return this->solved;
+			}
+			
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		
+		return false;
+	}
+	
+	std::chrono::steady_clock::duration delay;
+	
+	int result;
+	
+	bool solved;
+};
+
+class ThrowingPlanner : public TimedPlanner
+{
+public:
+	ThrowingPlanner() :
+		TimedPlanner(std::chrono::steady_clock::duration::zero(), 0)
+	{
+	}
+	
+	bool solve()
+	{
+		throw std::runtime_error("ThrowingPlanner");
+	}
+};
+
+int
+main(int argc, char** argv)
+{
+	rl::math::Vector start = rl::math::Vector::Zero(2);
+	rl::math::Vector goal = rl::math::Vector::Ones(2);
+	
+	// first successful planner wins and cancels the others
+	
+	{
+		TimedPlanner failing(std::chrono::milliseconds(0), 0);
+		TimedPlanner slow(std::chrono::milliseconds(0), -1);
+		TimedPlanner fast(std::chrono::milliseconds(50), 2);
+		TimedPlanner slower(std::chrono::milliseconds(5000), 3);
+		
+		rl::plan::ParallelPlanner planner;
+		planner.addPlanner(&failing);
+		planner.addPlanner(&slow);
+		planner.addPlanner(&fast);
+		planner.addPlanner(&slower);
+		planner.setDuration(std::chrono::seconds(20));
+		planner.setGoal(&goal);
+		planner.setStart(&start);
+		
+		std::chrono::steady_clock::time_point time = std::chrono::steady_clock::now();
+		bool solved = planner.solve();
+		std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - time;
+		
+		if (!solved || &fast != planner.getWinner())
+		{
+			std::cerr << "Fastest successful planner did not win" << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		if (elapsed > std::chrono::seconds(2))
+		{
+			std::cerr << "Remaining planners were not canceled" << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		if (slower.solved)
+		{
+			std::cerr << "Canceled planner reported a solution" << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		rl::plan::VectorList path = planner.getPath();
+		
+		if (3 != path.size() || !(*++path.begin()).isApprox(rl::math::Vector::Constant(2, 2)))
+		{
+			std::cerr << "Path was not taken from winning planner" << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		planner.reset();
+		
+		if (nullptr != planner.getWinner() || !planner.getPath().empty())
+		{
+			std::cerr << "Winner not cleared by reset" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	
+	// no planner finds a solution
+	
+	{
+		TimedPlanner failing1(std::chrono::milliseconds(0), 0);
+		TimedPlanner failing2(std::chrono::milliseconds(20), 0);
+		
+		rl::plan::ParallelPlanner planner;
+		planner.addPlanner(&failing1);
+		planner.addPlanner(&failing2);
+		planner.setGoal(&goal);
+		planner.setStart(&start);
+		
+		if (planner.solve() || nullptr != planner.getWinner() || !planner.getPath().empty())
+		{
+			std::cerr << "Unsolved problem reported a solution" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	
+	// duration is forwarded to all planners
+	
+	{
+		TimedPlanner running1(std::chrono::milliseconds(0), -1);
+		TimedPlanner running2(std::chrono::milliseconds(0), -1);
+		
+		rl::plan::ParallelPlanner planner;
+		planner.addPlanner(&running1);
+		planner.addPlanner(&running2);
+		planner.setDuration(std::chrono::milliseconds(100));
+		planner.setGoal(&goal);
+		planner.setStart(&start);
+		
+		if (planner.solve() || !planner.getPath().empty())
+		{
+			std::cerr << "Expired planners reported a solution" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	
+	// cancellation from another thread stops all planners
+	
+	{
+		TimedPlanner running1(std::chrono::milliseconds(0), -1);
+		TimedPlanner running2(std::chrono::milliseconds(0), -1);
+		
+		rl::plan::ParallelPlanner planner;
+		planner.addPlanner(&running1);
+		planner.addPlanner(&running2);
+		planner.setDuration(std::chrono::seconds(20));
+		planner.setGoal(&goal);
+		planner.setStart(&start);
+		
+		std::chrono::steady_clock::time_point time = std::chrono::steady_clock::now();
+		std::thread thread(&rl::plan::ParallelPlanner::solve, &planner);
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		planner.setCanceled(true);
+		thread.join();
+		
+		if (std::chrono::steady_clock::now() - time > std::chrono::seconds(2) || running1.solved || running2.solved)
+		{
+			std::cerr << "Cancellation did not stop planners" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	
+	// exceptions are rethrown after all threads joined
+	
+	{
+		ThrowingPlanner throwing;
+		TimedPlanner succeeding(std::chrono::milliseconds(20), 1);
+		
+		rl::plan::ParallelPlanner planner;
+		planner.addPlanner(&throwing);
+		planner.addPlanner(&succeeding);
+		planner.setDuration(std::chrono::seconds(20));
+		planner.setGoal(&goal);
+		planner.setStart(&start);
+		
+		try
+		{
+			planner.solve();
+			std::cerr << "Exception of planner was not rethrown" << std::endl;
+			return EXIT_FAILURE;
+		}
+		catch (const std::runtime_error&)
+		{
+		}
+	}
+	
+	// exception in one planner cancels the others
+	
+	{
+		ThrowingPlanner throwing;
+		TimedPlanner running(std::chrono::milliseconds(0), -1);
+		
+		rl::plan::ParallelPlanner planner;
+		planner.addPlanner(&throwing);
+		planner.addPlanner(&running);
+		planner.setDuration(std::chrono::seconds(20));
+		planner.setGoal(&goal);
+		planner.setStart(&start);
+		
+		std::chrono::steady_clock::time_point time = std::chrono::steady_clock::now();
+		
+		try
+		{
+			planner.solve();
+			std::cerr << "Exception of planner was not rethrown" << std::endl;
+			return EXIT_FAILURE;
+		}
+		catch (const std::runtime_error&)
+		{
+		}
+		
+		if (std::chrono::steady_clock::now() - time > std::chrono::seconds(2))
+		{
+			std::cerr << "Exception did not cancel remaining planners" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	
+	return EXIT_SUCCESS;
+}
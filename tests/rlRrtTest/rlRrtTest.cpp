@@ -0,0 +1,287 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <boost/lexical_cast.hpp>
+#include <rl/math/Constants.h>
+#include <rl/mdl/Kinematic.h>
+#include <rl/mdl/XmlFactory.h>
+#include <rl/plan/AddRrtConCon.h>
+#include <rl/plan/KdtreeNearestNeighbors.h>
+#include <rl/plan/RrtCon.h>
+#include <rl/plan/RrtConCon.h>
+#include <rl/plan/RrtExtCon.h>
+#include <rl/plan/RrtExtExt.h>
+#include <rl/plan/RrtGoalBias.h>
+#include <rl/plan/SimpleModel.h>
+#include <rl/plan/UniformSampler.h>
+#include <rl/sg/Model.h>
+#include <rl/sg/XmlFactory.h>
+
+#ifdef RL_SG_BULLET
+#include <rl/sg/bullet/Scene.h>
+#endif // RL_SG_BULLET
+#ifdef RL_SG_FCL
+#include <rl/sg/fcl/Scene.h>
+#endif // RL_SG_FCL
+#ifdef RL_SG_PQP
+#include <rl/sg/pqp/Scene.h>
+#endif // RL_SG_PQP
+#ifdef RL_SG_SDF
+#include <rl/sg/sdf/Scene.h>
+#endif // RL_SG_SDF
+#ifdef RL_SG_SOLID
+#include <rl/sg/solid/Scene.h>
+#endif // RL_SG_SOLID
+
+#ifdef __GLIBC__
+// count heap allocations of the whole process, including Eigen and the
+// libraries, by interposing the allocation functions of glibc
+
+extern "C" void* __libc_calloc(std::size_t n, std::size_t size);
+extern "C" void* __libc_malloc(std::size_t size);
+extern "C" void* __libc_realloc(void* ptr, std::size_t size);
+
+static std::size_t allocations = 0;
+
+extern "C" void*
+calloc(std::size_t n, std::size_t size)
+{
+	++allocations;
+	return __libc_calloc(n, size);
+}
+
+extern "C" void*
+malloc(std::size_t size)
+{
+	++allocations;
+	return __libc_malloc(size);
+}
+
+extern "C" void*
+realloc(void* ptr, std::size_t size)
+{
+	++allocations;
+	return __libc_realloc(ptr, size);
+}
+#endif // __GLIBC__
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 10)
+	{
+		std::cout << "Usage: rlRrtTest ENGINE SCENEFILE KINEMATICSFILE X Y Z A B C START1 ... STARTn GOAL1 ... GOALn" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	try
+	{
+		std::shared_ptr<rl::sg::Scene> scene;
+		
+#ifdef RL_SG_BULLET
+		if ("bullet" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::bullet::Scene>();
+		}
+#endif // RL_SG_BULLET
+#ifdef RL_SG_FCL
+		if ("fcl" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::fcl::Scene>();
+		}
+#endif // RL_SG_FCL
+#ifdef RL_SG_PQP
+		if ("pqp" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::pqp::Scene>();
+		}
+#endif // RL_SG_PQP
+#ifdef RL_SG_SDF
+		if ("sdf" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::sdf::Scene>();
+		}
+#endif // RL_SG_SDF
+#ifdef RL_SG_SOLID
+		if ("solid" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::solid::Scene>();
+		}
+#endif // RL_SG_SOLID
+		
+		rl::sg::XmlFactory factory1;
+		factory1.load(argv[2], scene.get());
+		
+		rl::mdl::XmlFactory factory2;
+		std::shared_ptr<rl::mdl::Kinematic> kinematic = std::dynamic_pointer_cast<rl::mdl::Kinematic>(factory2.create(argv[3]));
+		
+		rl::math::Transform world = rl::math::Transform::Identity();
+		
+		world = rl::math::AngleAxis(
+			boost::lexical_cast<rl::math::Real>(argv[9]) * rl::math::constants::deg2rad,
+			rl::math::Vector3::UnitZ()
+		) * rl::math::AngleAxis(
+			boost::lexical_cast<rl::math::Real>(argv[8]) * rl::math::constants::deg2rad,
+			rl::math::Vector3::UnitY()
+		) * rl::math::AngleAxis(
+			boost::lexical_cast<rl::math::Real>(argv[7]) * rl::math::constants::deg2rad,
+			rl::math::Vector3::UnitX()
+		);
+		
+		world.translation().x() = boost::lexical_cast<rl::math::Real>(argv[4]);
+		world.translation().y() = boost::lexical_cast<rl::math::Real>(argv[5]);
+		world.translation().z() = boost::lexical_cast<rl::math::Real>(argv[6]);
+		
+		kinematic->world() = world;
+		
+		Eigen::Matrix<rl::math::Units, Eigen::Dynamic, 1> qUnits = kinematic->getPositionUnits();
+		
+		rl::math::Vector start(kinematic->getDofPosition());
+		rl::math::Vector goal(kinematic->getDofPosition());
+		
+		if (argc < 10 + 2 * start.size())
+		{
+			std::cerr << "Expected " << start.size() << " values for start and goal." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		for (std::ptrdiff_t i = 0; i < start.size(); ++i)
+		{
+			start(i) = boost::lexical_cast<rl::math::Real>(argv[i + 10]);
+			goal(i) = boost::lexical_cast<rl::math::Real>(argv[start.size() + i + 10]);
+			
+			if (rl::math::Units::radian == qUnits(i))
+			{
+				start(i) *= rl::math::constants::deg2rad;
+				goal(i) *= rl::math::constants::deg2rad;
+			}
+		}
+		
+		rl::plan::SimpleModel model;
+		model.mdl = kinematic.get();
+		model.model = scene->getModel(0);
+		model.scene = scene.get();
+		
+		std::vector<std::pair<std::shared_ptr<rl::plan::Rrt>, std::size_t>> planners;
+		planners.push_back(std::make_pair(std::make_shared<rl::plan::AddRrtConCon>(), 2));
+		planners.push_back(std::make_pair(std::make_shared<rl::plan::RrtCon>(), 1));
+		planners.push_back(std::make_pair(std::make_shared<rl::plan::RrtConCon>(), 2));
+		planners.push_back(std::make_pair(std::make_shared<rl::plan::RrtExtCon>(), 2));
+		planners.push_back(std::make_pair(std::make_shared<rl::plan::RrtExtExt>(), 2));
+		planners.push_back(std::make_pair(std::make_shared<rl::plan::RrtGoalBias>(), 1));
+		
+		for (std::size_t i = 0; i < planners.size(); ++i)
+		{
+			rl::plan::Rrt& planner = *planners[i].first;
+			
+			rl::plan::KdtreeNearestNeighbors nearestNeighbors0(&model);
+			rl::plan::KdtreeNearestNeighbors nearestNeighbors1(&model);
+			rl::plan::UniformSampler sampler;
+			
+			planner.setModel(&model);
+			planner.setNearestNeighbors(&nearestNeighbors0, 0);
+			
+			if (planners[i].second > 1)
+			{
+				planner.setNearestNeighbors(&nearestNeighbors1, 1);
+			}
+			
+			planner.setSampler(&sampler);
+			
+			sampler.setModel(&model);
+			sampler.seed(0);
+			
+			if (rl::plan::RrtGoalBias* rrtGoalBias = dynamic_cast<rl::plan::RrtGoalBias*>(&planner))
+			{
+				rrtGoalBias->seed(0);
+			}
+			
+			planner.setDelta(1 * rl::math::constants::deg2rad);
+			planner.setDuration(std::chrono::seconds(300));
+			planner.setGoal(&goal);
+			planner.setStart(&start);
+			
+			if (!planner.verify())
+			{
+				std::cerr << "Start and goal need to be valid and free." << std::endl;
+				return EXIT_FAILURE;
+			}
+			
+#ifdef __GLIBC__
+			std::size_t allocationsStart = allocations;
+#endif // __GLIBC__
+			std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+			bool solved = planner.solve();
+			std::chrono::steady_clock::time_point stopTime = std::chrono::steady_clock::now();
+#ifdef __GLIBC__
+			std::size_t allocationsStop = allocations;
+#endif // __GLIBC__
+			
+			std::cout << planner.getName() << ": solve() " << (solved ? "true" : "false") << " " << std::chrono::duration_cast<std::chrono::duration<double>>(stopTime - startTime).count() * 1000 << " ms";
+			std::cout << ", " << planner.getNumVertices() << " vertices";
+#ifdef __GLIBC__
+			std::cout << ", " << allocationsStop - allocationsStart << " allocations";
+			std::cout << " (" << static_cast<double>(allocationsStop - allocationsStart) / planner.getNumVertices() << " per vertex)";
+#endif // __GLIBC__
+			std::cout << std::endl;
+			
+			if (!solved)
+			{
+				return EXIT_FAILURE;
+			}
+			
+			rl::plan::VectorList path = planner.getPath();
+			
+			if (model.distance(path.front(), start) > planner.getEpsilon() || model.distance(path.back(), goal) > planner.getEpsilon())
+			{
+				std::cerr << planner.getName() << ": path does not connect start and goal." << std::endl;
+				return EXIT_FAILURE;
+			}
+			
+			for (rl::plan::VectorList::iterator j = path.begin(); j != path.end(); ++j)
+			{
+				if (model.isColliding(*j))
+				{
+					std::cerr << planner.getName() << ": path contains a colliding configuration." << std::endl;
+					return EXIT_FAILURE;
+				}
+			}
+			
+			planner.reset();
+		}
+		
+		return EXIT_SUCCESS;
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+}
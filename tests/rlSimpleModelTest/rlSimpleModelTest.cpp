@@ -0,0 +1,219 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <boost/lexical_cast.hpp>
+#include <rl/mdl/Kinematic.h>
+#include <rl/mdl/XmlFactory.h>
+#include <rl/plan/SimpleModel.h>
+#include <rl/plan/UniformSampler.h>
+#include <rl/sg/Model.h>
+#include <rl/sg/SimpleScene.h>
+#include <rl/sg/XmlFactory.h>
+
+#ifdef RL_SG_BULLET
+#include <rl/sg/bullet/Scene.h>
+#endif // RL_SG_BULLET
+#ifdef RL_SG_FCL
+#include <rl/sg/fcl/Scene.h>
+#endif // RL_SG_FCL
+#ifdef RL_SG_ODE
+#include <rl/sg/ode/Scene.h>
+#endif // RL_SG_ODE
+#ifdef RL_SG_PQP
+#include <rl/sg/pqp/Scene.h>
+#endif // RL_SG_PQP
+#ifdef RL_SG_SDF
+#include <rl/sg/sdf/Scene.h>
+#endif // RL_SG_SDF
+#ifdef RL_SG_SOLID
+#include <rl/sg/solid/Scene.h>
+#endif // RL_SG_SOLID
+
+// all pairs in scene order without broad phase
+bool
+collides(rl::plan::SimpleModel& model, std::size_t& body, std::size_t& pairs)
+{
+	rl::sg::SimpleScene* scene = dynamic_cast<rl::sg::SimpleScene*>(model.scene);
+	
+	for (std::size_t i = 0; i < model.model->getNumBodies(); ++i)
+	{
+		if (model.isColliding(i))
+		{
+			for (rl::sg::Scene::Iterator j = scene->begin(); j != scene->end(); ++j)
+			{
+				if (model.model != *j)
+				{
+					for (rl::sg::Model::Iterator k = (*j)->begin(); k != (*j)->end(); ++k)
+					{
+						++pairs;
+						
+						if (scene->areColliding(model.model->getBody(i), *k))
+						{
+							body = i;
+							return true;
+						}
+					}
+				}
+			}
+		}
+		
+		for (std::size_t j = 0; j < i; ++j)
+		{
+			if (model.areColliding(i, j))
+			{
+				++pairs;
+				
+				if (scene->areColliding(model.model->getBody(i), model.model->getBody(j)))
+				{
+					body = i;
+					return true;
+				}
+			}
+		}
+	}
+	
+	body = model.getBodies();
+	return false;
+}
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 5)
+	{
+		std::cout << "Usage: rlSimpleModelTest ENGINE SCENEFILE KINEMATICSFILE COUNT" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	try
+	{
+		std::shared_ptr<rl::sg::Scene> scene;
+		
+#ifdef RL_SG_BULLET
+		if ("bullet" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::bullet::Scene>();
+		}
+#endif // RL_SG_BULLET
+#ifdef RL_SG_FCL
+		if ("fcl" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::fcl::Scene>();
+		}
+#endif // RL_SG_FCL
+#ifdef RL_SG_ODE
+		if ("ode" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::ode::Scene>();
+		}
+#endif // RL_SG_ODE
+#ifdef RL_SG_PQP
+		if ("pqp" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::pqp::Scene>();
+		}
+#endif // RL_SG_PQP
+#ifdef RL_SG_SDF
+		if ("sdf" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::sdf::Scene>();
+		}
+#endif // RL_SG_SDF
+#ifdef RL_SG_SOLID
+		if ("solid" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::solid::Scene>();
+		}
+#endif // RL_SG_SOLID
+		
+		rl::sg::XmlFactory factory1;
+		factory1.load(argv[2], scene.get());
+		
+		rl::mdl::XmlFactory factory2;
+		std::shared_ptr<rl::mdl::Kinematic> kinematic = std::dynamic_pointer_cast<rl::mdl::Kinematic>(factory2.create(argv[3]));
+		
+		rl::plan::SimpleModel model;
+		model.mdl = kinematic.get();
+		model.model = scene->getModel(0);
+		model.scene = scene.get();
+		
+		rl::plan::UniformSampler sampler;
+		sampler.setModel(&model);
+		sampler.seed(0);
+		
+		std::size_t count = boost::lexical_cast<std::size_t>(argv[4]);
+		std::size_t colliding = 0;
+		std::size_t pairs = 0;
+		
+		// distance fields report collisions within a margin around disjoint bounding boxes
+		bool conservative = "sdf" == std::string(argv[1]);
+		
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			rl::math::Vector q = sampler.generate();
+			
+			bool result = model.isColliding(q);
+			
+			std::size_t body;
+			bool expected = collides(model, body, pairs);
+			
+			if (conservative ? result && !expected : result != expected || model.getCollidingBody() != body)
+			{
+				std::cerr << "Configuration " << i << " is " << (result ? "colliding" : "free") << " in body " << model.getCollidingBody() << " with broad phase, but " << (expected ? "colliding" : "free") << " in body " << body << " without." << std::endl;
+				return EXIT_FAILURE;
+			}
+			
+			if (expected)
+			{
+				++colliding;
+			}
+		}
+		
+		std::cout << "Colliding: " << colliding << "  PairQueries: " << model.getPairQueries() << "  without broad phase: " << pairs << std::endl;
+		
+		if (0 == colliding || count == colliding)
+		{
+			std::cerr << "Configurations need to include both colliding and free cases." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		if (model.getPairQueries() >= pairs)
+		{
+			std::cerr << "No body pairs were culled by broad phase." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		return EXIT_SUCCESS;
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+}
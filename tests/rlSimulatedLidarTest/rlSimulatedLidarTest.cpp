@@ -0,0 +1,207 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <chrono>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <rl/hal/SimulatedLidar.h>
+#include <rl/math/Constants.h>
+#include <rl/sg/RaycastScene.h>
+#include <rl/sg/XmlFactory.h>
+
+#ifdef RL_SG_BULLET
+#include <rl/sg/bullet/Scene.h>
+#endif // RL_SG_BULLET
+#ifdef RL_SG_ODE
+#include <rl/sg/ode/Scene.h>
+#endif // RL_SG_ODE
+#ifdef RL_SG_SOLID
+#include <rl/sg/solid/Scene.h>
+#endif // RL_SG_SOLID
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 3)
+	{
+		std::cout << "Usage: rlSimulatedLidarTest ENGINE SCENEFILE" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	try
+	{
+		std::shared_ptr<rl::sg::RaycastScene> scene;
+		
+#ifdef RL_SG_BULLET
+		if ("bullet" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::bullet::Scene>();
+		}
+#endif // RL_SG_BULLET
+#ifdef RL_SG_ODE
+		if ("ode" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::ode::Scene>();
+		}
+#endif // RL_SG_ODE
+#ifdef RL_SG_SOLID
+		if ("solid" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::solid::Scene>();
+		}
+#endif // RL_SG_SOLID
+		
+		if (nullptr == scene)
+		{
+			std::cerr << "Unknown engine " << argv[1] << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		rl::sg::XmlFactory factory;
+		factory.load(argv[2], scene.get());
+		
+		// batch raycast needs to agree with single raycasts limited to the same segment
+		
+		std::mt19937 randomEngine(0);
+		std::uniform_real_distribution<rl::math::Real> uniformDistribution(-1, 1);
+		
+		std::vector<rl::math::Vector3> sources;
+		std::vector<rl::math::Vector3> targets;
+		
+		for (std::size_t i = 0; i < 1000; ++i)
+		{
+			rl::math::Vector3 source(1.9 * uniformDistribution(randomEngine), 1.9 * uniformDistribution(randomEngine), 0.4 * uniformDistribution(randomEngine));
+			rl::math::Vector3 direction(uniformDistribution(randomEngine), uniformDistribution(randomEngine), 0.2 * uniformDistribution(randomEngine));
+			sources.push_back(source);
+			targets.push_back(source + 4 * (1 + uniformDistribution(randomEngine)) * direction.normalized());
+		}
+		
+		std::vector<rl::sg::Shape*> shapes;
+		rl::math::Vector distances;
+		
+		scene->raycast(sources, targets, shapes, distances);
+		
+		if (shapes.size() != sources.size() || static_cast<std::size_t>(distances.size()) != sources.size())
+		{
+			std::cerr << "Batch raycast returned " << shapes.size() << " shapes and " << distances.size() << " distances for " << sources.size() << " rays" << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		std::size_t hits = 0;
+		
+		for (std::size_t i = 0; i < sources.size(); ++i)
+		{
+			rl::math::Real distance;
+			rl::sg::Shape* shape = scene->raycast(sources[i], targets[i], distance);
+			
+			if (nullptr != shape && distance > (targets[i] - sources[i]).norm())
+			{
+				shape = nullptr;
+			}
+			
+			if (shape != shapes[i] || (nullptr != shape && std::abs(distance - distances(i)) > static_cast<rl::math::Real>(1.0e-4)))
+			{
+				std::cerr << "Ray " << i << " from " << sources[i].transpose() << " to " << targets[i].transpose() << ": batch " << shapes[i] << " at " << distances(i) << ", single " << shape << " at " << distance << std::endl;
+				return EXIT_FAILURE;
+			}
+			
+			if (nullptr == shapes[i] && !std::isnan(distances(i)))
+			{
+				std::cerr << "Ray " << i << " without hit reports distance " << distances(i) << std::endl;
+				return EXIT_FAILURE;
+			}
+			
+			if (nullptr != shape)
+			{
+				++hits;
+			}
+		}
+		
+		std::cout << "Batch raycast agrees with single raycast for " << sources.size() << " rays (" << hits << " hits)" << std::endl;
+		
+		if (0 == hits || sources.size() == hits)
+		{
+			std::cerr << "Rays need to include both hits and misses" << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		// room is open towards +x, walls at y = +/-2 and x = -2
+		
+		rl::hal::SimulatedLidar lidar(scene.get(), std::chrono::milliseconds(0));
+		lidar.open();
+		lidar.start();
+		lidar.step();
+		
+		rl::math::Vector scan = lidar.getDistances();
+		
+		for (std::size_t i = 0; i < lidar.getDistancesCount(); ++i)
+		{
+			rl::math::Real angle = lidar.getStartAngle() + i * lidar.getResolution();
+			
+			if (std::abs(std::abs(angle) - 45 * rl::math::constants::deg2rad) < 1 * rl::math::constants::deg2rad || std::abs(std::abs(angle) - 135 * rl::math::constants::deg2rad) < 1 * rl::math::constants::deg2rad)
+			{
+				continue;
+			}
+			
+			if (std::abs(angle) < 45 * rl::math::constants::deg2rad)
+			{
+				if (!std::isinf(scan(i)) || nullptr != lidar.getShapes()[i])
+				{
+					std::cerr << "Beam " << i << " at " << angle * rl::math::constants::rad2deg << " deg: expected no echo, got " << scan(i) << std::endl;
+					return EXIT_FAILURE;
+				}
+			}
+			else
+			{
+				rl::math::Real expected = 2 / std::abs(std::sin(angle));
+				
+				if (std::abs(scan(i) - expected) > static_cast<rl::math::Real>(1.0e-3) || nullptr == lidar.getShapes()[i])
+				{
+					std::cerr << "Beam " << i << " at " << angle * rl::math::constants::rad2deg << " deg: expected " << expected << ", got " << scan(i) << std::endl;
+					return EXIT_FAILURE;
+				}
+			}
+		}
+		
+		lidar.stop();
+		lidar.close();
+		
+		std::cout << "Lidar scan of " << lidar.getDistancesCount() << " beams matches room geometry" << std::endl;
+	}
+	catch (const std::exception& e)
+	{
+		std::cerr << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	return EXIT_SUCCESS;
+}
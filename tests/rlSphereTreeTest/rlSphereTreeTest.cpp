@@ -0,0 +1,201 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <boost/lexical_cast.hpp>
+#include <rl/mdl/Kinematic.h>
+#include <rl/mdl/XmlFactory.h>
+#include <rl/plan/SimpleModel.h>
+#include <rl/plan/UniformSampler.h>
+#include <rl/sg/Body.h>
+#include <rl/sg/Model.h>
+#include <rl/sg/XmlFactory.h>
+
+#ifdef RL_SG_BULLET
+#include <rl/sg/bullet/Scene.h>
+#endif // RL_SG_BULLET
+#ifdef RL_SG_FCL
+#include <rl/sg/fcl/Scene.h>
+#endif // RL_SG_FCL
+#ifdef RL_SG_ODE
+#include <rl/sg/ode/Scene.h>
+#endif // RL_SG_ODE
+#ifdef RL_SG_PQP
+#include <rl/sg/pqp/Scene.h>
+#endif // RL_SG_PQP
+#ifdef RL_SG_SOLID
+#include <rl/sg/solid/Scene.h>
+#endif // RL_SG_SOLID
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 6)
+	{
+		std::cout << "Usage: rlSphereTreeTest ENGINE SCENEFILE KINEMATICSFILE LEAF_SIZE COUNT" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	try
+	{
+		std::shared_ptr<rl::sg::Scene> scene;
+		
+#ifdef RL_SG_BULLET
+		if ("bullet" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::bullet::Scene>();
+		}
+#endif // RL_SG_BULLET
+#ifdef RL_SG_FCL
+		if ("fcl" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::fcl::Scene>();
+		}
+#endif // RL_SG_FCL
+#ifdef RL_SG_ODE
+		if ("ode" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::ode::Scene>();
+		}
+#endif // RL_SG_ODE
+#ifdef RL_SG_PQP
+		if ("pqp" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::pqp::Scene>();
+		}
+#endif // RL_SG_PQP
+#ifdef RL_SG_SOLID
+		if ("solid" == std::string(argv[1]))
+		{
+			scene = std::make_shared<rl::sg::solid::Scene>();
+		}
+#endif // RL_SG_SOLID
+		
+		rl::sg::XmlFactory factory1;
+		factory1.load(argv[2], scene.get(), true, true);
+		
+		// points need to be in body coordinates like the bounding boxes, also for translated shapes
+		
+		for (rl::sg::Scene::Iterator i = scene->begin(); i != scene->end(); ++i)
+		{
+			for (rl::sg::Model::Iterator j = (*i)->begin(); j != (*i)->end(); ++j)
+			{
+				for (std::size_t k = 0; k < (*j)->points.size(); ++k)
+				{
+					if (
+						((*j)->points[k] - (*j)->max).maxCoeff() > static_cast<rl::math::Real>(1.0e-4) ||
+						((*j)->min - (*j)->points[k]).maxCoeff() > static_cast<rl::math::Real>(1.0e-4)
+					)
+					{
+						std::cerr << "Point " << (*j)->points[k].transpose() << " of body '" << (*j)->getName() << "' is outside of bounding box." << std::endl;
+						return EXIT_FAILURE;
+					}
+				}
+			}
+		}
+		
+		rl::mdl::XmlFactory factory2;
+		std::shared_ptr<rl::mdl::Kinematic> kinematic = std::dynamic_pointer_cast<rl::mdl::Kinematic>(factory2.create(argv[3]));
+		
+		rl::plan::SimpleModel exact;
+		exact.mdl = kinematic.get();
+		exact.model = scene->getModel(0);
+		exact.scene = scene.get();
+		
+		rl::plan::SimpleModel model;
+		model.mdl = kinematic.get();
+		model.model = scene->getModel(0);
+		model.scene = scene.get();
+		model.setSphereTreeLeafSize(boost::lexical_cast<std::size_t>(argv[4]));
+		
+		rl::plan::UniformSampler sampler;
+		sampler.setModel(&model);
+		sampler.seed(0);
+		
+		std::size_t count = boost::lexical_cast<std::size_t>(argv[5]);
+		std::vector<rl::math::Vector> q(count);
+		
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			q[i] = sampler.generate();
+		}
+		
+		std::vector<bool> expected(count);
+		
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			expected[i] = exact.isColliding(q[i]);
+		}
+		
+		std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+		std::cout << "exact: " << std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count() * 1000 << " ms" << std::endl;
+		
+		// builds trees outside of the timed loop
+		model.isColliding(q[0]);
+		model.reset();
+		
+		std::vector<bool> colliding(count);
+		
+		start = std::chrono::steady_clock::now();
+		
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			colliding[i] = model.isColliding(q[i]);
+		}
+		
+		stop = std::chrono::steady_clock::now();
+		std::cout << "sphere trees: " << std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count() * 1000 << " ms" << std::endl;
+		
+		std::cout << "FreeQueries: " << exact.getFreeQueries() << "  SphereTreeHits: " << model.getSphereTreeHits() << std::endl;
+		
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			if (colliding[i] != expected[i])
+			{
+				std::cerr << "Configuration " << i << " is " << (colliding[i] ? "colliding" : "free") << " with sphere trees, but " << (expected[i] ? "colliding" : "free") << " with exact check." << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+		
+		if (0 == model.getSphereTreeHits())
+		{
+			std::cerr << "No body pairs were decided by sphere trees." << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		return EXIT_SUCCESS;
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+}
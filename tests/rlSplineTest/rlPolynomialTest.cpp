@@ -24,7 +24,9 @@
 // POSSIBILITY OF SUCH DAMAGE.
 //
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
 #include <rl/math/Polynomial.h>
 
 int
@@ -120,6 +122,30 @@ main(int argc, char** argv)
 		}
 	}
 	
+	{
+		rl::math::Polynomial<rl::math::Real> p = rl::math::Polynomial<rl::math::Real>::SepticFirstSecondThird(y0, y1, yd0, yd1, ydd0, ydd1, yddd0, yddd1, x1);
+		
+		std::vector<rl::math::Real> y(10);
+		
+		for (rl::math::Real x = 0; x < x1; x += 0.25)
+		{
+			p(x, y);
+			
+			rl::math::Polynomial<rl::math::Real> f = p;
+			
+			for (std::size_t i = 0; i < y.size(); ++i, f = f.derivative())
+			{
+				rl::math::Real tolerance = eps * std::max(static_cast<rl::math::Real>(1), std::abs(f(x)));
+				
+				if (std::abs(y[i] - f(x)) > tolerance || std::abs(p(x, i) - f(x)) > tolerance)
+				{
+					std::cerr << "rlPolynomialTest: SepticFirstSecondThird derivatives in single pass" << std::endl;
+					return EXIT_FAILURE;
+				}
+			}
+		}
+	}
+	
 	std::cout << "rlPolynomialTest is ok." << std::endl;
 	return EXIT_SUCCESS;
 }
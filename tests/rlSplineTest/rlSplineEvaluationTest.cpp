@@ -0,0 +1,145 @@
+//
+// Copyright (c) 2009, Markus Rickert, Andre Gaschler
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <rl/math/Array.h>
+#include <rl/math/Spline.h>
+
+rl::math::ArrayX
+scan(const rl::math::Spline<rl::math::ArrayX>& spline, const rl::math::Real& x)
+{
+	rl::math::Real x0 = spline.lower();
+	std::size_t i = 0;
+	
+	for (; x > x0 + spline[i].duration() && i + 1 < spline.size(); ++i)
+	{
+		x0 += spline[i].duration();
+	}
+	
+	return spline[i](x - x0);
+}
+
+bool
+test(const rl::math::Spline<rl::math::ArrayX>& spline, const std::string& name)
+{
+	rl::math::Real step = 0.001;
+	std::size_t samples = static_cast<std::size_t>(spline.duration() / step);
+	rl::math::Real eps = 1.0e-8;
+	
+	std::vector<rl::math::ArrayX> reference(samples);
+	std::vector<rl::math::ArrayX> search(samples);
+	std::vector<rl::math::ArrayX> cursor(samples);
+	
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	
+	for (std::size_t i = 0; i < samples; ++i)
+	{
+		reference[i] = scan(spline, spline.lower() + i * step);
+	}
+	
+	std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+	
+	std::cout << name << " " << spline.size() << " segments (linear scan) " << std::chrono::duration<double, std::nano>(stop - start).count() / samples << " ns" << std::endl;
+	
+	start = std::chrono::steady_clock::now();
+	
+	for (std::size_t i = 0; i < samples; ++i)
+	{
+		search[i] = spline(spline.lower() + i * step);
+	}
+	
+	stop = std::chrono::steady_clock::now();
+	
+	std::cout << name << " " << spline.size() << " segments (binary search) " << std::chrono::duration<double, std::nano>(stop - start).count() / samples << " ns" << std::endl;
+	
+	start = std::chrono::steady_clock::now();
+	
+	rl::math::Spline<rl::math::ArrayX>::Cursor c(spline);
+	
+	for (std::size_t i = 0; i < samples; ++i)
+	{
+		cursor[i] = c(spline.lower() + i * step);
+	}
+	
+	stop = std::chrono::steady_clock::now();
+	
+	std::cout << name << " " << spline.size() << " segments (cursor) " << std::chrono::duration<double, std::nano>(stop - start).count() / samples << " ns" << std::endl;
+	
+	for (std::size_t i = 0; i < samples; ++i)
+	{
+		if ((reference[i] - search[i]).matrix().norm() > eps || (reference[i] - cursor[i]).matrix().norm() > eps)
+		{
+			std::cerr << name << " differs from linear scan at x = " << spline.lower() + i * step << std::endl;
+			return false;
+		}
+	}
+	
+	for (std::size_t i = 0; i < 8; ++i)
+	{
+		std::size_t j = samples - 1 - i * (samples / 8);
+		
+		if ((reference[j] - c(spline.lower() + j * step)).matrix().norm() > eps)
+		{
+			std::cerr << name << " cursor differs from linear scan at decreasing x = " << spline.lower() + j * step << std::endl;
+			return false;
+		}
+	}
+	
+	return true;
+}
+
+int
+main(int argc, char** argv)
+{
+	std::size_t n = 1000;
+	
+	std::srand(0);
+	
+	std::vector<rl::math::Real> x(n);
+	std::vector<rl::math::ArrayX> y(n);
+	
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		x[i] = i;
+		y[i] = rl::math::ArrayX::Random(6);
+	}
+	
+	if (!test(rl::math::Spline<rl::math::ArrayX>::CubicNatural(x, y), "CubicNatural"))
+	{
+		return EXIT_FAILURE;
+	}
+	
+	if (!test(rl::math::Spline<rl::math::ArrayX>::LinearParabolic(x, y, 0.2), "LinearParabolic"))
+	{
+		return EXIT_FAILURE;
+	}
+	
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,168 @@
+//
+// Copyright (c) 2009, Markus Rickert, Andre Gaschler
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <rl/math/Array.h>
+#include <rl/math/Matrix.h>
+#include <rl/math/Spline.h>
+#include <rl/math/TrapezoidalVelocity.h>
+
+bool
+test(const rl::math::Spline<rl::math::ArrayX>& spline, const rl::math::ArrayX& x, const std::string& name)
+{
+	rl::math::Real eps = 1.0e-8;
+	
+	std::vector<rl::math::ArrayX> reference(3 * x.size());
+	
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	
+	for (std::ptrdiff_t i = 0; i < x.size(); ++i)
+	{
+		for (std::size_t j = 0; j < 3; ++j)
+		{
+			reference[3 * i + j] = spline(x[i], j);
+		}
+	}
+	
+	std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+	
+	std::cout << name << " " << x.size() << " samples (per sample) " << std::chrono::duration<double, std::nano>(stop - start).count() / x.size() << " ns" << std::endl;
+	
+	std::vector<rl::math::Matrix> y(3);
+	
+	start = std::chrono::steady_clock::now();
+	spline(x, y);
+	stop = std::chrono::steady_clock::now();
+	
+	std::cout << name << " " << x.size() << " samples (batch) " << std::chrono::duration<double, std::nano>(stop - start).count() / x.size() << " ns" << std::endl;
+	
+	for (std::ptrdiff_t i = 0; i < x.size(); ++i)
+	{
+		for (std::size_t j = 0; j < 3; ++j)
+		{
+			if ((reference[3 * i + j].matrix().transpose() - y[j].row(i)).norm() > eps * std::max(static_cast<rl::math::Real>(1), reference[3 * i + j].matrix().norm()))
+			{
+				std::cerr << name << " derivative " << j << " differs from per sample evaluation at x = " << x[i] << std::endl;
+				return false;
+			}
+		}
+	}
+	
+	return true;
+}
+
+bool
+test(const rl::math::TrapezoidalVelocity<rl::math::Real>& interpolator, const rl::math::ArrayX& t)
+{
+	rl::math::Real eps = 1.0e-8;
+	
+	rl::math::ArrayX x(t.size());
+	rl::math::ArrayX v(t.size());
+	rl::math::ArrayX a(t.size());
+	
+	interpolator.x(t, x);
+	interpolator.v(t, v);
+	interpolator.a(t, a);
+	
+	for (std::ptrdiff_t i = 0; i < t.size(); ++i)
+	{
+		if (std::abs(interpolator.x(t[i]) - x[i]) > eps || std::abs(interpolator.v(t[i]) - v[i]) > eps || std::abs(interpolator.a(t[i]) - a[i]) > eps)
+		{
+			std::cerr << "TrapezoidalVelocity differs from per sample evaluation at t = " << t[i] << std::endl;
+			return false;
+		}
+	}
+	
+	return true;
+}
+
+int
+main(int argc, char** argv)
+{
+	std::size_t n = 1000;
+	std::ptrdiff_t samples = 100000;
+	
+	std::srand(0);
+	
+	std::vector<rl::math::Real> x(n);
+	std::vector<rl::math::ArrayX> y(n);
+	
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		x[i] = i;
+		y[i] = rl::math::ArrayX::Random(6);
+	}
+	
+	rl::math::ArrayX sorted = rl::math::ArrayX::LinSpaced(samples, x.front(), x.back());
+	rl::math::ArrayX unsorted = (rl::math::ArrayX::Random(samples) + 1) / 2 * (x.back() - x.front()) + x.front();
+	
+	rl::math::Spline<rl::math::ArrayX> cubic = rl::math::Spline<rl::math::ArrayX>::CubicNatural(x, y);
+	
+	if (!test(cubic, sorted, "CubicNatural sorted"))
+	{
+		return EXIT_FAILURE;
+	}
+	
+	if (!test(cubic, unsorted, "CubicNatural unsorted"))
+	{
+		return EXIT_FAILURE;
+	}
+	
+	rl::math::Spline<rl::math::ArrayX> linearParabolic = rl::math::Spline<rl::math::ArrayX>::LinearParabolic(x, y, 0.2);
+	
+	if (!test(linearParabolic, sorted, "LinearParabolic sorted"))
+	{
+		return EXIT_FAILURE;
+	}
+	
+	if (!test(linearParabolic, unsorted, "LinearParabolic unsorted"))
+	{
+		return EXIT_FAILURE;
+	}
+	
+	rl::math::TrapezoidalVelocity<rl::math::Real> interpolator;
+	interpolator.x0 = 50;
+	interpolator.xe = -200;
+	interpolator.v0 = 5;
+	interpolator.ve = 0;
+	interpolator.vm = 10.5;
+	interpolator.am = 0.055;
+	interpolator.dm = 0.055;
+	interpolator.interpolate();
+	
+	if (!test(interpolator, rl::math::ArrayX::LinSpaced(1000, 0, interpolator.t() * 1.1)))
+	{
+		return EXIT_FAILURE;
+	}
+	
+	return EXIT_SUCCESS;
+}
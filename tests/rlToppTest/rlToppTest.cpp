@@ -0,0 +1,247 @@
+//
+// Copyright (c) 2009, Markus Rickert
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <boost/lexical_cast.hpp>
+#include <rl/math/Array.h>
+#include <rl/mdl/Dynamic.h>
+#include <rl/mdl/XmlFactory.h>
+#include <rl/plan/Exception.h>
+#include <rl/plan/Topp.h>
+
+bool
+check(const std::shared_ptr<rl::mdl::Dynamic>& dynamic, const rl::plan::Topp& topp, const rl::plan::VectorList& path, const std::string& name, rl::math::Real& duration)
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	rl::math::Spline<rl::math::Vector> trajectory = topp.process(path);
+	std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+	
+	duration = trajectory.duration();
+	
+	std::cout << name << " " << duration << " s in " << std::chrono::duration<double, std::milli>(stop - start).count() << " ms" << std::endl;
+	
+	if (!trajectory(trajectory.lower()).isApprox(path.front()) || !trajectory(trajectory.upper()).isApprox(path.back()))
+	{
+		std::cerr << name << " does not connect start and goal" << std::endl;
+		return false;
+	}
+	
+	if (!trajectory(trajectory.lower(), 1).isZero() || !trajectory(trajectory.upper(), 1).isZero())
+	{
+		std::cerr << name << " does not start and end at rest" << std::endl;
+		return false;
+	}
+	
+	// joint speeds and accelerations are bounded within each grid interval,
+	// joint torques only at the grid points
+	
+	rl::math::Real tolerance = static_cast<rl::math::Real>(1.0001);
+	rl::math::Real toleranceTorque = static_cast<rl::math::Real>(1.1);
+	
+	std::vector<rl::math::Matrix> y(3);
+	trajectory(rl::math::ArrayX::LinSpaced(10 * topp.steps, trajectory.lower(), trajectory.upper()), y);
+	
+	for (std::ptrdiff_t i = 0; i < y[0].rows(); ++i)
+	{
+		if ((y[1].row(i).array().abs() > tolerance * dynamic->getSpeed().transpose().array()).any())
+		{
+			std::cerr << name << " exceeds speed limits: " << y[1].row(i) << std::endl;
+			return false;
+		}
+		
+		if ((y[2].row(i).array().abs() > tolerance * topp.acceleration.transpose().array()).any())
+		{
+			std::cerr << name << " exceeds acceleration limits: " << y[2].row(i) << std::endl;
+			return false;
+		}
+		
+		if (topp.torque.size() > 0)
+		{
+			dynamic->setPosition(y[0].row(i).transpose());
+			dynamic->setVelocity(y[1].row(i).transpose());
+			dynamic->setAcceleration(y[2].row(i).transpose());
+			dynamic->inverseDynamics();
+			
+			if ((dynamic->getTorque().array().abs() > toleranceTorque * topp.torque.array()).any())
+			{
+				std::cerr << name << " exceeds torque limits: " << dynamic->getTorque().transpose() << std::endl;
+				return false;
+			}
+		}
+	}
+	
+	return true;
+}
+
+int
+main(int argc, char** argv)
+{
+	if (argc < 3)
+	{
+		std::cout << "Usage: rlToppTest MODELFILE WAYPOINTS" << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	try
+	{
+		rl::mdl::XmlFactory factory;
+		std::shared_ptr<rl::mdl::Dynamic> dynamic = std::dynamic_pointer_cast<rl::mdl::Dynamic>(factory.create(argv[1]));
+		
+		std::size_t waypoints = boost::lexical_cast<std::size_t>(argv[2]);
+		
+		std::mt19937 randEngine(0);
+		std::uniform_real_distribution<rl::math::Real> randDistribution(0, 1);
+		
+		rl::plan::VectorList path;
+		
+		for (std::size_t i = 0; i < waypoints; ++i)
+		{
+			rl::math::Vector rand(dynamic->getDofPosition());
+			
+			for (std::size_t j = 0; j < dynamic->getDofPosition(); ++j)
+			{
+				rand(j) = randDistribution(randEngine);
+			}
+			
+			path.push_back(dynamic->generatePositionUniform(rand));
+		}
+		
+		rl::plan::Topp topp;
+		topp.model = dynamic.get();
+		topp.steps = 200;
+		
+		// limits not matching the degrees of freedom of the model
+		
+		try
+		{
+			topp.process(path);
+			std::cerr << "Topp accepted missing acceleration limits" << std::endl;
+			return EXIT_FAILURE;
+		}
+		catch (const rl::plan::Exception&)
+		{
+		}
+		
+		topp.acceleration = 2 * dynamic->getSpeed();
+		topp.torque = rl::math::Vector::Ones(dynamic->getDof() + 1);
+		
+		try
+		{
+			topp.process(path);
+			std::cerr << "Topp accepted torque limits of wrong size" << std::endl;
+			return EXIT_FAILURE;
+		}
+		catch (const rl::plan::Exception&)
+		{
+		}
+		
+		topp.torque.resize(0);
+		
+		// rest-to-rest motion between waypoints with trapezoidal velocity profiles
+		
+		rl::math::Real reference = 0;
+		
+		for (rl::plan::VectorList::const_iterator i = path.begin(), j = ++path.begin(); j != path.end(); ++i, ++j)
+		{
+			rl::math::Real segment = 0;
+			
+			for (std::size_t k = 0; k < dynamic->getDof(); ++k)
+			{
+				rl::math::Real distance = std::abs((*j)(k) - (*i)(k));
+				rl::math::Real speed = dynamic->getSpeed()(k);
+				rl::math::Real acceleration = topp.acceleration(k);
+				
+				if (distance > speed * speed / acceleration)
+				{
+					segment = std::max(segment, distance / speed + speed / acceleration);
+				}
+				else
+				{
+					segment = std::max(segment, 2 * std::sqrt(distance / acceleration));
+				}
+			}
+			
+			reference += segment;
+		}
+		
+		std::cout << "Trapezoidal rest-to-rest " << reference << " s" << std::endl;
+		
+		rl::math::Real duration;
+		
+		if (!check(dynamic, topp, path, "Topp", duration))
+		{
+			return EXIT_FAILURE;
+		}
+		
+		if (duration > reference)
+		{
+			std::cerr << "Topp is slower than trapezoidal rest-to-rest" << std::endl;
+			return EXIT_FAILURE;
+		}
+		
+		// torque limits above gravity along the straight path segments
+		
+		rl::math::Vector torque = rl::math::Vector::Zero(dynamic->getDof());
+		
+		for (rl::plan::VectorList::const_iterator i = path.begin(), j = ++path.begin(); j != path.end(); ++i, ++j)
+		{
+			for (std::size_t k = 0; k < 100; ++k)
+			{
+				dynamic->setPosition(*i + (*j - *i) * k / static_cast<rl::math::Real>(99));
+				dynamic->calculateGravity();
+				torque = torque.cwiseMax(dynamic->getGravity().cwiseAbs());
+			}
+		}
+		
+		topp.torque = 2 * torque + rl::math::Vector::Ones(dynamic->getDof());
+		
+		rl::math::Real durationTorque;
+		
+		if (!check(dynamic, topp, path, "Topp (torque)", durationTorque))
+		{
+			return EXIT_FAILURE;
+		}
+		
+		if (durationTorque < duration)
+		{
+			std::cerr << "Topp (torque) is faster than without torque limits" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	catch (const std::exception& e)
+	{
+		std::cerr << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	
+	return EXIT_SUCCESS;
+}